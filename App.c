@@ -15,6 +15,17 @@
 #include "Dio.h"
 #include "Port.h"
 #include "Mcu.h"
+#include "Os.h"
+
+#if (PORT_PIN_EDGE_NOTIFICATION_API == STD_ON)
+/* Description: Notification of an edge of the button pin called from the GPIO interrupt,
+ *              releases the button task at once to read the new level instead of at its next frame */
+static void App_ButtonEdgeNotification(void)
+{
+    Button_EdgeNotification();
+    Os_ActivateTask(OS_TASK_ID_Button_Task);
+}
+#endif
 
 /* Description: Task executes once to initialize all the Modules */
 void Init_Task(void)
@@ -28,6 +39,11 @@ void Init_Task(void)
     /* Initialize Dio Driver */
     Dio_Init(&Dio_Configuration);
 
+#if (PORT_PIN_EDGE_NOTIFICATION_API == STD_ON)
+    /* Notify the button presses and releases from the GPIO interrupt */
+    Port_SetPinEdgeNotification(PortConf_SW1_PIN_ID_INDEX, PORT_PIN_EDGE_BOTH, App_ButtonEdgeNotification);
+#endif
+
 //
 //
 //    /* Initialize LED Driver */
@@ -37,10 +53,21 @@ void Init_Task(void)
 //    Button_Init();
 }
 
-/* Description: Task executes every 20 Mili-seconds to check the button state */
+/* Description: Task executes every 20 Mili-seconds and on every edge of the button pin to check the button state,
+ *              a change of the state releases the application task at once instead of at its next frame */
 void Button_Task(void)
 {
+#if (PORT_PIN_EDGE_NOTIFICATION_API == STD_ON)
+    uint8 previous_state = Button_GetState();
+
+    Button_RefreshState();
+    if(Button_GetState() != previous_state)
+    {
+        Os_ActivateTask(OS_TASK_ID_App_Task);
+    }
+#else
     Button_RefreshState();
+#endif
 }
 
 /* Description: Task executes every 40 Mili-seconds to refresh the LED */
@@ -49,7 +76,8 @@ void Led_Task(void)
     Led_RefreshOutput();
 }
 
-/* Description: Task executes every 60 Mili-seconds to get the button status and toggle the led */
+/* Description: Task executes every 60 Mili-seconds and on every change of the button state (after Button_Task)
+ *              to get the button status and toggle the led */
 void App_Task(void)
 {
     static uint8 button_previous_state = BUTTON_RELEASED;
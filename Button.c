@@ -18,6 +18,67 @@
 /* Global variable to hold the button state */
 static uint8 g_button_state = BUTTON_RELEASED;
 
+#if (BUTTON_PORT_DEBOUNCE_API == STD_ON)
+#if ((BUTTON_DEBOUNCE_SAMPLES == 0U) || (BUTTON_DEBOUNCE_SAMPLES > 3U))
+#error "The vertical counter of Button_RefreshPorts counts up to 3 samples"
+#endif
+
+/* Levels of the lanes when the buttons are released */
+#define BUTTON_RELEASED_LEVELS         ((BUTTON_RELEASED == STD_HIGH) ? (uint8)0xFF : (uint8)0x00)
+
+/* Lanes pressed in a set of levels */
+#define BUTTON_PRESSED_LANES(LEVELS)   ((uint8)((BUTTON_PRESSED == STD_HIGH) ? (LEVELS) : ~(LEVELS)))
+
+/* Lanes whose vertical counter (COUNT1:COUNT0) reached BUTTON_DEBOUNCE_SAMPLES */
+#define BUTTON_COUNT_REACHED(COUNT1, COUNT0) \
+    ((uint8)((((BUTTON_DEBOUNCE_SAMPLES & 2U) != 0U) ? (COUNT1) : ~(COUNT1)) & \
+             (((BUTTON_DEBOUNCE_SAMPLES & 1U) != 0U) ? (COUNT0) : ~(COUNT0))))
+
+/* Configuration of one debounced port */
+typedef struct
+{
+    Dio_PortType Dio_Port; /* Dio port read by Button_RefreshPorts */
+    uint8 Lanes;           /* Debounced lanes of the port */
+} Button_PortConfigType;
+
+/* Debounce state of the 8 lanes of one port, bit n of each member is lane n */
+typedef struct
+{
+    uint8 Levels;   /* Debounced levels */
+    uint8 Count0;   /* Bit 0 of the count of consecutive samples different from the debounced level */
+    uint8 Count1;   /* Bit 1 of the count */
+    uint8 Pressed;  /* Lanes pressed by the last refresh */
+    uint8 Released; /* Lanes released by the last refresh */
+} Button_PortDebounceType;
+
+#define BUTTON_PORT_CONFIG_ENTRY(NAME, DIO_PORT, LANES)   {DIO_PORT, LANES},
+#define BUTTON_PORT_STATE_ENTRY(NAME, DIO_PORT, LANES)    {BUTTON_RELEASED_LEVELS, 0, 0, 0, 0},
+
+/* Configuration of the debounced ports */
+static const Button_PortConfigType g_Button_Ports_Config[BUTTON_PORT_ID_INVALID] = {
+    BUTTON_DEBOUNCED_PORTS_LIST(BUTTON_PORT_CONFIG_ENTRY)
+};
+
+/* Debounce state of the debounced ports, all the lanes start released */
+static Button_PortDebounceType g_Button_Ports[BUTTON_PORT_ID_INVALID] = {
+    BUTTON_DEBOUNCED_PORTS_LIST(BUTTON_PORT_STATE_ENTRY)
+};
+#endif
+
+#if (PORT_PIN_EDGE_NOTIFICATION_API == STD_ON)
+/* Global variable to indicate an edge of the button pin not handled yet, set by the GPIO interrupt */
+static volatile uint8 g_Edge_Pending = FALSE;
+
+/* Number of samples the pin is still ignored after a state change committed on an edge */
+static uint8 g_Lockout_Count = 0;
+
+/* Global variable to indicate an edge waiting for the next sample to confirm its level */
+static boolean g_Edge_Armed = FALSE;
+
+/* Level read on the armed edge */
+static uint8 g_Edge_Level = STD_HIGH;
+#endif
+
 /*******************************************************************************************************************/
 /* Description: Called by the Button_Init function (only) used to fill the Button configurations structure */
 /*it isn't need as the configuration is already done in port configuration see Port_PBcfg.c*/
@@ -38,7 +99,11 @@ uint8 Button_GetState(void)
 /*******************************************************************************************************************/
 void Button_RefreshState(void)
 {
+#if (DIO_STATIC_CHANNEL_API == STD_ON)
+    uint8 state = Dio_ReadChannel_SW1();
+#else
     uint8 state = Dio_ReadChannel(DioConf_SW1_CHANNEL_ID_INDEX);
+#endif
 
     /* Count the number of Pressed times increment if the switch pressed for 20 ms */
     static uint8 g_Pressed_Count  = 0;
@@ -46,28 +111,124 @@ void Button_RefreshState(void)
     /* Count the number of Released times increment if the switch released for 20 ms */
     static uint8 g_Released_Count = 0;
 
-    if(state == BUTTON_PRESSED)
+#if (PORT_PIN_EDGE_NOTIFICATION_API == STD_ON)
+    if(g_Edge_Pending == TRUE)
+    {
+        g_Edge_Pending = FALSE;
+
+        /* Edge of a press or a release, its level waits for the next sample, a bounce back to the state disarms it */
+        if(g_Lockout_Count == 0)
+        {
+            g_Edge_Level = state;
+            g_Edge_Armed = (state != g_button_state) ? TRUE : FALSE;
+        }
+    }
+    else if(g_Lockout_Count > 0)
     {
-        g_Pressed_Count++;
-        g_Released_Count = 0;
+        /* The pin may still bounce, the sample is ignored */
+        g_Lockout_Count--;
+    }
+    else if(g_Edge_Armed == TRUE)
+    {
+        g_Edge_Armed = FALSE;
+
+        /* The pin still reads the level of the edge, commit it then ignore the bouncing, else it was a spike */
+        if(state == g_Edge_Level)
+        {
+            g_button_state   = state;
+            g_Lockout_Count  = BUTTON_DEBOUNCE_SAMPLES;
+            g_Pressed_Count  = 0;
+            g_Released_Count = 0;
+        }
     }
     else
+#endif
     {
-        g_Released_Count++;
-        g_Pressed_Count = 0;
+        if(state == BUTTON_PRESSED)
+        {
+            g_Pressed_Count++;
+            g_Released_Count = 0;
+        }
+        else
+        {
+            g_Released_Count++;
+            g_Pressed_Count = 0;
+        }
+
+        if(g_Pressed_Count == BUTTON_DEBOUNCE_SAMPLES)
+        {
+            g_button_state = BUTTON_PRESSED;
+            g_Pressed_Count       = 0;
+            g_Released_Count      = 0;
+        }
+        else if(g_Released_Count == BUTTON_DEBOUNCE_SAMPLES)
+        {
+            g_button_state = BUTTON_RELEASED;
+            g_Released_Count      = 0;
+            g_Pressed_Count       = 0;
+        }
     }
+}
 
-    if(g_Pressed_Count == 3)
+#if (PORT_PIN_EDGE_NOTIFICATION_API == STD_ON)
+/*******************************************************************************************************************/
+void Button_EdgeNotification(void)
+{
+    g_Edge_Pending = TRUE;
+}
+#endif
+/*******************************************************************************************************************/
+
+#if (BUTTON_PORT_DEBOUNCE_API == STD_ON)
+/*******************************************************************************************************************/
+void Button_RefreshPorts(void)
+{
+    uint8 Port;
+    uint8 Delta;
+    uint8 Toggle;
+    Button_PortDebounceType *Debounce_Ptr;
+
+    for(Port = 0; Port < BUTTON_PORT_ID_INVALID; Port++)
     {
-        g_button_state = BUTTON_PRESSED;
-        g_Pressed_Count       = 0;
-        g_Released_Count      = 0;
+        Debounce_Ptr = &g_Button_Ports[Port];
+
+        /* Lanes sampled at a level different from their debounced one, the whole port is read once */
+        Delta = (uint8)((Dio_ReadPort_Fast(g_Button_Ports_Config[Port].Dio_Port) ^ Debounce_Ptr->Levels) & g_Button_Ports_Config[Port].Lanes);
+
+        /* Count up the lanes of Delta, the other lanes restart from 0 */
+        Debounce_Ptr->Count1 = (uint8)((Debounce_Ptr->Count1 ^ Debounce_Ptr->Count0) & Delta);
+        Debounce_Ptr->Count0 = (uint8)(~Debounce_Ptr->Count0 & Delta);
+
+        /* The lanes that stayed at the new level for BUTTON_DEBOUNCE_SAMPLES samples change their state */
+        Toggle = (uint8)(BUTTON_COUNT_REACHED(Debounce_Ptr->Count1, Debounce_Ptr->Count0) & Delta);
+        Debounce_Ptr->Count1 &= (uint8)~Toggle;
+        Debounce_Ptr->Count0 &= (uint8)~Toggle;
+        Debounce_Ptr->Levels ^= Toggle;
+
+        Debounce_Ptr->Pressed  = (uint8)(Toggle & BUTTON_PRESSED_LANES(Debounce_Ptr->Levels));
+        Debounce_Ptr->Released = (uint8)(Toggle & ~BUTTON_PRESSED_LANES(Debounce_Ptr->Levels));
     }
-    else if(g_Released_Count == 3)
+}
+
+/*******************************************************************************************************************/
+uint8 Button_GetPortState(Button_PortIdType Port_Id)
+{
+    uint8 Pressed_Lanes = 0;
+
+    if(Port_Id < BUTTON_PORT_ID_INVALID)
     {
-        g_button_state = BUTTON_RELEASED;
-        g_Released_Count      = 0;
-        g_Pressed_Count       = 0;
+        Pressed_Lanes = (uint8)(BUTTON_PRESSED_LANES(g_Button_Ports[Port_Id].Levels) & g_Button_Ports_Config[Port_Id].Lanes);
     }
+    return Pressed_Lanes;
 }
+
 /*******************************************************************************************************************/
+void Button_GetPortEdges(Button_PortIdType Port_Id, uint8 *Pressed_Ptr, uint8 *Released_Ptr)
+{
+    if((Port_Id < BUTTON_PORT_ID_INVALID) && (Pressed_Ptr != NULL_PTR) && (Released_Ptr != NULL_PTR))
+    {
+        *Pressed_Ptr  = g_Button_Ports[Port_Id].Pressed;
+        *Released_Ptr = g_Button_Ports[Port_Id].Released;
+    }
+}
+#endif
@@ -13,6 +13,7 @@
 
 #include "Std_Types.h"
 #include "Button_Cfg.h"
+#include "Port_Cfg.h"
 
 /* 
  * Description: 1. Fill the button configurations structure 
@@ -31,4 +32,38 @@ uint8 Button_GetState(void);
  */   
 void Button_RefreshState(void);
 
+#if (BUTTON_PORT_DEBOUNCE_API == STD_ON)
+/* Description: Id of each debounced port (BUTTON_PORT_ID_<Name>), in the order of BUTTON_DEBOUNCED_PORTS_LIST,
+ *              BUTTON_PORT_ID_INVALID is also the number of the debounced ports */
+#define BUTTON_PORT_ID_ENTRY(NAME, DIO_PORT, LANES)   BUTTON_PORT_ID_##NAME,
+typedef enum
+{
+    BUTTON_DEBOUNCED_PORTS_LIST(BUTTON_PORT_ID_ENTRY)
+    BUTTON_PORT_ID_INVALID
+} Button_PortIdType;
+
+/*
+ * Description: This function is to be called every 20ms by the Os Task of an application consuming
+ *              the port edges (none in the shipped task table), it reads each debounced port once and
+ *              debounces its 8 lanes together with a vertical counter (one bit of each lane per byte),
+ *              a lane changes its state after BUTTON_DEBOUNCE_SAMPLES consecutive samples at the new level.
+ */
+void Button_RefreshPorts(void);
+
+/* Description: Read the debounced pressed lanes of a port (bit n set if lane n is pressed) */
+uint8 Button_GetPortState(Button_PortIdType Port_Id);
+
+/* Description: Read the lanes of a port pressed and released by the last Button_RefreshPorts call */
+void Button_GetPortEdges(Button_PortIdType Port_Id, uint8 *Pressed_Ptr, uint8 *Released_Ptr);
+#endif
+
+#if (PORT_PIN_EDGE_NOTIFICATION_API == STD_ON)
+/*
+ * Description: Notification of an edge of the button pin, called from the GPIO interrupt.
+ *              The next Button_RefreshState call reads the new level, the following one commits
+ *              it if the pin still reads it then ignores the pin bouncing for BUTTON_DEBOUNCE_SAMPLES samples.
+ */
+void Button_EdgeNotification(void);
+#endif
+
 #endif /* BUTTON_H */
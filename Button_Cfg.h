@@ -16,6 +16,27 @@
 #define BUTTON_PRESSED  STD_LOW
 #define BUTTON_RELEASED STD_HIGH
 
+/* Number of consecutive samples (Button_RefreshState calls) with the same level to change the button state,
+ * also the number of samples the pin is ignored after a state change committed on an edge.
+ * An edge only commits its level if the pin still reads it at the next sample: a spike shorter than one
+ * sample period never changes the state, at the cost of up to one sample period (OS_BASE_TIME) of latency
+ * instead of BUTTON_DEBOUNCE_SAMPLES periods without the edge notification. */
+#define BUTTON_DEBOUNCE_SAMPLES (3U)
+
+/* precompile option for the whole port debouncer (Button_RefreshPorts), BUTTON_DEBOUNCE_SAMPLES must be 1 to 3 */
+#define BUTTON_PORT_DEBOUNCE_API (STD_ON)
+
+/*
+ * Ports debounced by Button_RefreshPorts, each entry is:
+ * BUTTON_PORT(Name, Dio port, input lanes mask)
+ * Only the lanes of the mask are debounced, the others never report an edge.
+ * A build can provide its own list to debounce other ports.
+ */
+#ifndef BUTTON_DEBOUNCED_PORTS_LIST
+#define BUTTON_DEBOUNCED_PORTS_LIST(BUTTON_PORT) \
+    BUTTON_PORT(PortF, DioConf_SW1_PORT_NUM, (uint8)(1U << DioConf_SW1_CHANNEL_NUM))
+#endif
+
 /* Set the Button Port */
 #define BUTTON_PORT DioConf_SW1_PORT_NUM
 
@@ -51,4 +51,14 @@
 /* This is used to define the abstraction of compiler keyword static */
 #define STATIC            static
 
+/*
+ * This is used to convert a peripheral register address to a pointer.
+ * On the target the address is used as it is, an off-target build can define
+ * HW_REGISTER_ADDRESS before this file is included to redirect every register
+ * access to a simulated register block.
+ */
+#ifndef HW_REGISTER_ADDRESS
+#define HW_REGISTER_ADDRESS(ADDRESS)  ((volatile uint32 *)(ADDRESS))
+#endif
+
 #endif
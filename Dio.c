@@ -12,6 +12,12 @@
 #include "Dio.h"
 #include "Dio_Regs.h"
 
+/* Port_Init moves the AHB ports to their aperture, Dio must access the same ports through it */
+#include "Port_Cfg.h"
+#if (DIO_AHB_PORTS_MASK != PORT_AHB_PORTS_MASK)
+  #error "DIO_AHB_PORTS_MASK in Dio_Cfg.h does not match PORT_AHB_PORTS_MASK in Port_Cfg.h"
+#endif
+
 #if (DIO_DEV_ERROR_DETECT == STD_ON)
 
 #include "Det.h"
@@ -24,9 +30,29 @@
 
 #endif
 
-STATIC const Dio_ConfigChannel * Dio_PortChannels = NULL_PTR;
 STATIC uint8 Dio_Status = DIO_NOT_INITIALIZED;
 
+/* Base address of each GPIO port indexed by the Port Id (0 --> PORTA .. 5 --> PORTF) */
+STATIC const uint32 Dio_PortBaseAddress[DIO_PORTS_NUMBER] = {
+                                                                DIO_PORTA_BASE_ADDRESS,
+                                                                DIO_PORTB_BASE_ADDRESS,
+                                                                DIO_PORTC_BASE_ADDRESS,
+                                                                DIO_PORTD_BASE_ADDRESS,
+                                                                DIO_PORTE_BASE_ADDRESS,
+                                                                DIO_PORTF_BASE_ADDRESS
+                                                            };
+
+/* Data register address and bit mask of every configured channel, filled once by Dio_Init */
+STATIC Dio_ChannelRegType Dio_ChannelRegs[DIO_CONFIGURED_CHANNLES];
+
+#if (DIO_BATCH_WRITE_API == STD_ON)
+/* Lanes of each port staged in the current batch */
+STATIC uint8 Dio_BatchMask[DIO_PORTS_NUMBER];
+
+/* Levels of the staged lanes of each port in the current batch */
+STATIC Dio_PortLevelType Dio_BatchLevel[DIO_PORTS_NUMBER];
+#endif
+
 /************************************************************************************
 * Service Name: Dio_Init
 * Service ID[hex]: 0x10
@@ -40,6 +66,8 @@ STATIC uint8 Dio_Status = DIO_NOT_INITIALIZED;
 ************************************************************************************/
 void Dio_Init(const Dio_ConfigType * ConfigPtr)
 {
+	Dio_ChannelType Channel;
+
 #if (DIO_DEV_ERROR_DETECT == STD_ON)
 	/* check if the input configuration pointer is not a NULL_PTR */
 	if (NULL_PTR == ConfigPtr)
@@ -51,11 +79,43 @@ void Dio_Init(const Dio_ConfigType * ConfigPtr)
 #endif
 	{
 		/*
-		 * Set the module state to initialized and point to the PB configuration structure using a global pointer.
-		 * This global pointer is global to be used by other functions to read the PB configuration structures
+		 * Resolve the data register address and the bit mask of each configured channel once,
+		 * so the channel APIs access the register directly without decoding the Port Id every call.
 		 */
-		Dio_Status       = DIO_INITIALIZED;
-		Dio_PortChannels = ConfigPtr->Channels; /* address of the first Channels structure --> Channels[0] */
+		for(Channel = 0; Channel < DIO_CONFIGURED_CHANNLES; Channel++)
+		{
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+			/* Check if the configured port is one of the available ports */
+			if (DIO_PORTS_NUMBER <= ConfigPtr->Channels[Channel].Port_Num)
+			{
+				Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_INIT_SID,
+				     DIO_E_PARAM_CONFIG);
+				return;
+			}
+			else
+			{
+				/* No Action Required */
+			}
+#endif
+			Dio_ChannelRegs[Channel].Mask     = ((uint32)1U << ConfigPtr->Channels[Channel].Ch_Num);
+			Dio_ChannelRegs[Channel].Port_Num = ConfigPtr->Channels[Channel].Port_Num;
+#if (DIO_BITBAND_ACCESS == STD_ON)
+			/* Use the bit-band alias word of the channel bit in the GPIODATA register which sees all the port lanes */
+			Dio_ChannelRegs[Channel].Data_Ptr = DIO_BITBAND_ADDRESS(Dio_PortBaseAddress[ConfigPtr->Channels[Channel].Port_Num] + ((uint32)DIO_DATA_ALL_LANES_MASK << 2),
+			                                                        ConfigPtr->Channels[Channel].Ch_Num);
+#elif (DIO_MASKED_DATA_ACCESS == STD_ON)
+			/* Use the GPIODATA alias which only sees this channel lane */
+			Dio_ChannelRegs[Channel].Data_Ptr = DIO_DATA_MASKED_ADDRESS(Dio_PortBaseAddress[ConfigPtr->Channels[Channel].Port_Num],
+			                                                            Dio_ChannelRegs[Channel].Mask);
+#else
+			/* Use the GPIODATA alias which sees all the port lanes */
+			Dio_ChannelRegs[Channel].Data_Ptr = DIO_DATA_MASKED_ADDRESS(Dio_PortBaseAddress[ConfigPtr->Channels[Channel].Port_Num],
+			                                                            DIO_DATA_ALL_LANES_MASK);
+#endif
+		}
+
+		/* Set the module state to initialized after all the channels are resolved */
+		Dio_Status = DIO_INITIALIZED;
 	}
 }
 
@@ -73,7 +133,6 @@ void Dio_Init(const Dio_ConfigType * ConfigPtr)
 ************************************************************************************/
 void Dio_WriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level)
 {
-	volatile uint32 * Port_Ptr = NULL_PTR;
 	boolean error = FALSE;
 
 #if (DIO_DEV_ERROR_DETECT == STD_ON)
@@ -105,32 +164,7 @@ void Dio_WriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level)
 	/* In-case there are no errors */
 	if(FALSE == error)
 	{
-		/* Point to the correct PORT register according to the Port Id stored in the Port_Num member */
-		switch(Dio_PortChannels[ChannelId].Port_Num)
-		{
-            case 0:    Port_Ptr = &GPIO_PORTA_DATA_REG;
-		               break;
-		    case 1:    Port_Ptr = &GPIO_PORTB_DATA_REG;
-		               break;
-		    case 2:    Port_Ptr = &GPIO_PORTC_DATA_REG;
-		               break;
-		    case 3:    Port_Ptr = &GPIO_PORTD_DATA_REG;
-		               break;
-            case 4:    Port_Ptr = &GPIO_PORTE_DATA_REG;
-		               break;
-            case 5:    Port_Ptr = &GPIO_PORTF_DATA_REG;
-		               break;
-		}
-		if(Level == STD_HIGH)
-		{
-			/* Write Logic High */
-			SET_BIT(*Port_Ptr,Dio_PortChannels[ChannelId].Ch_Num);
-		}
-		else if(Level == STD_LOW)
-		{
-			/* Write Logic Low */
-			CLEAR_BIT(*Port_Ptr,Dio_PortChannels[ChannelId].Ch_Num);
-		}
+		Dio_WriteChannel_Fast(ChannelId, Level);
 	}
 	else
 	{
@@ -139,6 +173,63 @@ void Dio_WriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level)
 
 }
 
+/************************************************************************************
+* Service Name: Dio_WriteChannel_Fast
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): ChannelId - ID of DIO channel.
+*                  Level - Value to be written.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to set a level of a channel.
+*              Unchecked variant without development error checks, the caller must
+*              guarantee the driver is initialized and ChannelId is valid.
+************************************************************************************/
+void Dio_WriteChannel_Fast(Dio_ChannelType ChannelId, Dio_LevelType Level)
+{
+	volatile uint32 * Port_Ptr = NULL_PTR;
+
+	/* Data register address and channel mask are already resolved by Dio_Init */
+	Port_Ptr = Dio_ChannelRegs[ChannelId].Data_Ptr;
+#if (DIO_BITBAND_ACCESS == STD_ON)
+	/* The bit-band alias word only holds this channel bit so a single store updates the pin */
+	if(Level == STD_HIGH)
+	{
+		/* Write Logic High */
+		*Port_Ptr = 1U;
+	}
+	else if(Level == STD_LOW)
+	{
+		/* Write Logic Low */
+		*Port_Ptr = 0U;
+	}
+#elif (DIO_MASKED_DATA_ACCESS == STD_ON)
+	/* The masked alias only sees this channel lane so a single store updates the pin without reading the port */
+	if(Level == STD_HIGH)
+	{
+		/* Write Logic High */
+		*Port_Ptr = Dio_ChannelRegs[ChannelId].Mask;
+	}
+	else if(Level == STD_LOW)
+	{
+		/* Write Logic Low */
+		*Port_Ptr = 0U;
+	}
+#else
+	if(Level == STD_HIGH)
+	{
+		/* Write Logic High */
+		*Port_Ptr |= Dio_ChannelRegs[ChannelId].Mask;
+	}
+	else if(Level == STD_LOW)
+	{
+		/* Write Logic Low */
+		*Port_Ptr &= ~(Dio_ChannelRegs[ChannelId].Mask);
+	}
+#endif
+}
+
 /************************************************************************************
 * Service Name: Dio_ReadChannel
 * Service ID[hex]: 0x00
@@ -152,7 +243,6 @@ void Dio_WriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level)
 ************************************************************************************/
 Dio_LevelType Dio_ReadChannel(Dio_ChannelType ChannelId)
 {
-	volatile uint32 * Port_Ptr = NULL_PTR;
 	Dio_LevelType output = STD_LOW;
 	boolean error = FALSE;
 
@@ -185,31 +275,244 @@ Dio_LevelType Dio_ReadChannel(Dio_ChannelType ChannelId)
 	/* In-case there are no errors */
 	if(FALSE == error)
 	{
-		/* Point to the correct PORT register according to the Port Id stored in the Port_Num member */
-		switch(Dio_PortChannels[ChannelId].Port_Num)
-		{
-            case 0:    Port_Ptr = &GPIO_PORTA_DATA_REG;
-		               break;
-		    case 1:    Port_Ptr = &GPIO_PORTB_DATA_REG;
-		               break;
-		    case 2:    Port_Ptr = &GPIO_PORTC_DATA_REG;
-		               break;
-		    case 3:    Port_Ptr = &GPIO_PORTD_DATA_REG;
-		               break;
-            case 4:    Port_Ptr = &GPIO_PORTE_DATA_REG;
-		               break;
-            case 5:    Port_Ptr = &GPIO_PORTF_DATA_REG;
-		               break;
-		}
-		/* Read the required channel */
-		if(GET_BIT(*Port_Ptr,Dio_PortChannels[ChannelId].Ch_Num) == STD_HIGH)
-		{
-			output = STD_HIGH;
-		}
-		else
-		{
-			output = STD_LOW;
-		}
+		output = Dio_ReadChannel_Fast(ChannelId);
+	}
+	else
+	{
+		/* No Action Required */
+	}
+        return output;
+}
+
+/************************************************************************************
+* Service Name: Dio_ReadChannel_Fast
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): ChannelId - ID of DIO channel.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Dio_LevelType
+* Description: Function to return the value of the specified DIO channel.
+*              Unchecked variant without development error checks, the caller must
+*              guarantee the driver is initialized and ChannelId is valid.
+************************************************************************************/
+Dio_LevelType Dio_ReadChannel_Fast(Dio_ChannelType ChannelId)
+{
+	volatile uint32 * Port_Ptr = NULL_PTR;
+	Dio_LevelType output = STD_LOW;
+
+	/* Data register address and channel mask are already resolved by Dio_Init */
+	Port_Ptr = Dio_ChannelRegs[ChannelId].Data_Ptr;
+	/* Read the required channel */
+#if (DIO_BITBAND_ACCESS == STD_ON)
+	if(*Port_Ptr != 0U)
+#else
+	if((*Port_Ptr & Dio_ChannelRegs[ChannelId].Mask) != 0U)
+#endif
+	{
+		output = STD_HIGH;
+	}
+	else
+	{
+		output = STD_LOW;
+	}
+	return output;
+}
+
+/************************************************************************************
+* Service Name: Dio_ReadPort
+* Service ID[hex]: 0x02
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): PortId - ID of DIO Port.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Dio_PortLevelType
+* Description: Function to return the level of all channels of the specified port.
+************************************************************************************/
+Dio_PortLevelType Dio_ReadPort(Dio_PortType PortId)
+{
+	Dio_PortLevelType output = STD_LOW;
+	boolean error = FALSE;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_READ_PORT_SID, DIO_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* Check if the used port is within the valid range */
+	if (DIO_PORTS_NUMBER <= PortId)
+	{
+
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_READ_PORT_SID, DIO_E_PARAM_INVALID_PORT_ID);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	/* In-case there are no errors */
+	if(FALSE == error)
+	{
+		output = Dio_ReadPort_Fast(PortId);
+	}
+	else
+	{
+		/* No Action Required */
+	}
+        return output;
+}
+
+/************************************************************************************
+* Service Name: Dio_ReadPort_Fast
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): PortId - ID of DIO Port.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Dio_PortLevelType
+* Description: Function to return the level of all channels of the specified port.
+*              Unchecked variant without development error checks, the caller must
+*              guarantee the driver is initialized and PortId is valid.
+************************************************************************************/
+Dio_PortLevelType Dio_ReadPort_Fast(Dio_PortType PortId)
+{
+	Dio_PortLevelType output = STD_LOW;
+
+	/* Read all the port lanes in a single access through the all-lanes GPIODATA alias */
+	output = (Dio_PortLevelType)(*DIO_DATA_MASKED_ADDRESS(Dio_PortBaseAddress[PortId], DIO_DATA_ALL_LANES_MASK));
+	return output;
+}
+
+/************************************************************************************
+* Service Name: Dio_WritePort
+* Service ID[hex]: 0x03
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): PortId - ID of DIO Port.
+*                  Level - Value to be written.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to set the level of all channels of the specified port.
+************************************************************************************/
+void Dio_WritePort(Dio_PortType PortId, Dio_PortLevelType Level)
+{
+	boolean error = FALSE;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_WRITE_PORT_SID, DIO_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* Check if the used port is within the valid range */
+	if (DIO_PORTS_NUMBER <= PortId)
+	{
+
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_WRITE_PORT_SID, DIO_E_PARAM_INVALID_PORT_ID);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	/* In-case there are no errors */
+	if(FALSE == error)
+	{
+		Dio_WritePort_Fast(PortId, Level);
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+
+/************************************************************************************
+* Service Name: Dio_WritePort_Fast
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): PortId - ID of DIO Port.
+*                  Level - Value to be written.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to set the level of all channels of the specified port.
+*              Unchecked variant without development error checks, the caller must
+*              guarantee the driver is initialized and PortId is valid.
+************************************************************************************/
+void Dio_WritePort_Fast(Dio_PortType PortId, Dio_PortLevelType Level)
+{
+	/* Write all the port lanes in a single store through the all-lanes GPIODATA alias */
+	*DIO_DATA_MASKED_ADDRESS(Dio_PortBaseAddress[PortId], DIO_DATA_ALL_LANES_MASK) = Level;
+}
+
+/************************************************************************************
+* Service Name: Dio_ReadChannelGroup
+* Service ID[hex]: 0x04
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): ChannelGroupIdPtr - Pointer to ChannelGroup.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Dio_PortLevelType
+* Description: Function to return the level of a subset of the adjoining bits of a port,
+*              shifted so the first channel of the group is the LSB.
+************************************************************************************/
+Dio_PortLevelType Dio_ReadChannelGroup(const Dio_ChannelGroupType *ChannelGroupIdPtr)
+{
+	Dio_PortLevelType output = STD_LOW;
+	boolean error = FALSE;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_READ_CHANNEL_GROUP_SID, DIO_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* Check if the group pointer is valid and the group port is within the valid range */
+	if ((NULL_PTR == ChannelGroupIdPtr) || (DIO_PORTS_NUMBER <= ChannelGroupIdPtr->PortIndex))
+	{
+
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_READ_CHANNEL_GROUP_SID, DIO_E_PARAM_INVALID_GROUP);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	/* In-case there are no errors */
+	if(FALSE == error)
+	{
+		output = Dio_ReadChannelGroup_Fast(ChannelGroupIdPtr);
 	}
 	else
 	{
@@ -218,6 +521,107 @@ Dio_LevelType Dio_ReadChannel(Dio_ChannelType ChannelId)
         return output;
 }
 
+/************************************************************************************
+* Service Name: Dio_ReadChannelGroup_Fast
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): ChannelGroupIdPtr - Pointer to ChannelGroup.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Dio_PortLevelType
+* Description: Function to return the level of a subset of the adjoining bits of a port,
+*              shifted so the first channel of the group is the LSB.
+*              Unchecked variant without development error checks, the caller must
+*              guarantee the driver is initialized and ChannelGroupIdPtr points to a valid group.
+************************************************************************************/
+Dio_PortLevelType Dio_ReadChannelGroup_Fast(const Dio_ChannelGroupType *ChannelGroupIdPtr)
+{
+	Dio_PortLevelType output = STD_LOW;
+
+	/* Read only the group lanes in a single access through the GPIODATA alias of the group mask */
+	output = (Dio_PortLevelType)((*DIO_DATA_MASKED_ADDRESS(Dio_PortBaseAddress[ChannelGroupIdPtr->PortIndex], ChannelGroupIdPtr->mask))
+	                             >> ChannelGroupIdPtr->offset);
+	return output;
+}
+
+/************************************************************************************
+* Service Name: Dio_WriteChannelGroup
+* Service ID[hex]: 0x05
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): ChannelGroupIdPtr - Pointer to ChannelGroup.
+*                  Level - Value to be written.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to set a subset of the adjoining bits of a port to the specified level,
+*              the other pins of the port are not affected.
+************************************************************************************/
+void Dio_WriteChannelGroup(const Dio_ChannelGroupType *ChannelGroupIdPtr, Dio_PortLevelType Level)
+{
+	boolean error = FALSE;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_WRITE_CHANNEL_GROUP_SID, DIO_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* Check if the group pointer is valid and the group port is within the valid range */
+	if ((NULL_PTR == ChannelGroupIdPtr) || (DIO_PORTS_NUMBER <= ChannelGroupIdPtr->PortIndex))
+	{
+
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_WRITE_CHANNEL_GROUP_SID, DIO_E_PARAM_INVALID_GROUP);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	/* In-case there are no errors */
+	if(FALSE == error)
+	{
+		Dio_WriteChannelGroup_Fast(ChannelGroupIdPtr, Level);
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+
+/************************************************************************************
+* Service Name: Dio_WriteChannelGroup_Fast
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): ChannelGroupIdPtr - Pointer to ChannelGroup.
+*                  Level - Value to be written.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to set a subset of the adjoining bits of a port to the specified level,
+*              the other pins of the port are not affected.
+*              Unchecked variant without development error checks, the caller must
+*              guarantee the driver is initialized and ChannelGroupIdPtr points to a valid group.
+************************************************************************************/
+void Dio_WriteChannelGroup_Fast(const Dio_ChannelGroupType *ChannelGroupIdPtr, Dio_PortLevelType Level)
+{
+	/*
+	 * The GPIODATA alias of the group mask only sees the group lanes,
+	 * so all the group pins change together in one store without touching the rest of the port
+	 */
+	*DIO_DATA_MASKED_ADDRESS(Dio_PortBaseAddress[ChannelGroupIdPtr->PortIndex], ChannelGroupIdPtr->mask) =
+	        ((uint32)Level << ChannelGroupIdPtr->offset);
+}
+
 /************************************************************************************
 * Service Name: Dio_GetVersionInfo
 * Service ID[hex]: 0x12
@@ -271,7 +675,6 @@ void Dio_GetVersionInfo(Std_VersionInfoType *versioninfo)
 #if (DIO_FLIP_CHANNEL_API == STD_ON)
 Dio_LevelType Dio_FlipChannel(Dio_ChannelType ChannelId)
 {
-	volatile uint32 * Port_Ptr = NULL_PTR;
 	Dio_LevelType output = STD_LOW;
 	boolean error = FALSE;
 
@@ -304,38 +707,231 @@ Dio_LevelType Dio_FlipChannel(Dio_ChannelType ChannelId)
 	/* In-case there are no errors */
 	if(FALSE == error)
 	{
-		/* Point to the correct PORT register according to the Port Id stored in the Port_Num member */
-		switch(Dio_PortChannels[ChannelId].Port_Num)
-		{
-            case 0:    Port_Ptr = &GPIO_PORTA_DATA_REG;
-		               break;
-		    case 1:    Port_Ptr = &GPIO_PORTB_DATA_REG;
-		               break;
-		    case 2:    Port_Ptr = &GPIO_PORTC_DATA_REG;
-		               break;
-		    case 3:    Port_Ptr = &GPIO_PORTD_DATA_REG;
-		               break;
-            case 4:    Port_Ptr = &GPIO_PORTE_DATA_REG;
-		               break;
-            case 5:    Port_Ptr = &GPIO_PORTF_DATA_REG;
-		               break;
-		}
-		/* Read the required channel and write the required level */
-		if(GET_BIT(*Port_Ptr,Dio_PortChannels[ChannelId].Ch_Num) == STD_HIGH)
-		{
-			CLEAR_BIT(*Port_Ptr,Dio_PortChannels[ChannelId].Ch_Num);
-			output = STD_LOW;
-		}
-		else
+		output = Dio_FlipChannel_Fast(ChannelId);
+	}
+	else
+	{
+		/* No Action Required */
+	}
+        return output;
+}
+
+/************************************************************************************
+* Service Name: Dio_FlipChannel_Fast
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): ChannelId - ID of DIO channel.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Dio_LevelType
+* Description: Function to flip the level of a channel and return the level of the channel after flip.
+*              Unchecked variant without development error checks, the caller must
+*              guarantee the driver is initialized and ChannelId is valid.
+************************************************************************************/
+Dio_LevelType Dio_FlipChannel_Fast(Dio_ChannelType ChannelId)
+{
+	volatile uint32 * Port_Ptr = NULL_PTR;
+	Dio_LevelType output = STD_LOW;
+
+	/* Data register address and channel mask are already resolved by Dio_Init */
+	Port_Ptr = Dio_ChannelRegs[ChannelId].Data_Ptr;
+	/* Read the required channel and write the required level */
+#if (DIO_BITBAND_ACCESS == STD_ON)
+	/* One read and one write of the bit-band alias word, the other pins of the port are never rewritten */
+	if(*Port_Ptr != 0U)
+	{
+		*Port_Ptr = 0U;
+		output = STD_LOW;
+	}
+	else
+	{
+		*Port_Ptr = 1U;
+		output = STD_HIGH;
+	}
+#elif (DIO_MASKED_DATA_ACCESS == STD_ON)
+	/* The masked alias only sees this channel lane so the other pins of the port are never rewritten */
+	if((*Port_Ptr & Dio_ChannelRegs[ChannelId].Mask) != 0U)
+	{
+		*Port_Ptr = 0U;
+		output = STD_LOW;
+	}
+	else
+	{
+		*Port_Ptr = Dio_ChannelRegs[ChannelId].Mask;
+		output = STD_HIGH;
+	}
+#else
+	if((*Port_Ptr & Dio_ChannelRegs[ChannelId].Mask) != 0U)
+	{
+		*Port_Ptr &= ~(Dio_ChannelRegs[ChannelId].Mask);
+		output = STD_LOW;
+	}
+	else
+	{
+		*Port_Ptr |= Dio_ChannelRegs[ChannelId].Mask;
+		output = STD_HIGH;
+	}
+#endif
+	return output;
+}
+#endif
+
+#if (DIO_BATCH_WRITE_API == STD_ON)
+/************************************************************************************
+* Service Name: Dio_BeginBatch
+* Service ID[hex]: 0x13
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to discard any staged channel levels and start a new batch.
+************************************************************************************/
+void Dio_BeginBatch(void)
+{
+	Dio_PortType Port;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_BEGIN_BATCH_SID, DIO_E_UNINIT);
+	}
+	else
+#endif
+	{
+		for(Port = 0; Port < DIO_PORTS_NUMBER; Port++)
 		{
-			SET_BIT(*Port_Ptr,Dio_PortChannels[ChannelId].Ch_Num);
-			output = STD_HIGH;
+			Dio_BatchMask[Port] = 0U;
 		}
 	}
+}
+
+/************************************************************************************
+* Service Name: Dio_BatchWriteChannel
+* Service ID[hex]: 0x14
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): ChannelId - ID of DIO channel.
+*                  Level - Value to be written at commit.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to stage the level of a channel in the shadow word of its port,
+*              the hardware is only updated by Dio_CommitBatch.
+************************************************************************************/
+void Dio_BatchWriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level)
+{
+	boolean error = FALSE;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_BATCH_WRITE_CHANNEL_SID, DIO_E_UNINIT);
+		error = TRUE;
+	}
 	else
 	{
 		/* No Action Required */
 	}
-        return output;
+	/* Check if the used channel is within the valid range */
+	if (DIO_CONFIGURED_CHANNLES <= ChannelId)
+	{
+
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_BATCH_WRITE_CHANNEL_SID, DIO_E_PARAM_INVALID_CHANNEL_ID);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	/* In-case there are no errors */
+	if(FALSE == error)
+	{
+		Dio_BatchWriteChannel_Fast(ChannelId, Level);
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+
+/************************************************************************************
+* Service Name: Dio_BatchWriteChannel_Fast
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): ChannelId - ID of DIO channel.
+*                  Level - Value to be written at commit.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to stage the level of a channel in the shadow word of its port,
+*              the hardware is only updated by Dio_CommitBatch.
+*              Unchecked variant without development error checks, the caller must
+*              guarantee the driver is initialized and ChannelId is valid.
+************************************************************************************/
+void Dio_BatchWriteChannel_Fast(Dio_ChannelType ChannelId, Dio_LevelType Level)
+{
+	if(Level == STD_HIGH)
+	{
+		/* Stage Logic High */
+		Dio_BatchMask[Dio_ChannelRegs[ChannelId].Port_Num]  |= (uint8)Dio_ChannelRegs[ChannelId].Mask;
+		Dio_BatchLevel[Dio_ChannelRegs[ChannelId].Port_Num] |= (uint8)Dio_ChannelRegs[ChannelId].Mask;
+	}
+	else if(Level == STD_LOW)
+	{
+		/* Stage Logic Low */
+		Dio_BatchMask[Dio_ChannelRegs[ChannelId].Port_Num]  |= (uint8)Dio_ChannelRegs[ChannelId].Mask;
+		Dio_BatchLevel[Dio_ChannelRegs[ChannelId].Port_Num] &= (uint8)(~Dio_ChannelRegs[ChannelId].Mask);
+	}
+}
+
+/************************************************************************************
+* Service Name: Dio_CommitBatch
+* Service ID[hex]: 0x15
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to write all the staged channel levels to the hardware,
+*              each touched port is written exactly once and the batch is emptied.
+************************************************************************************/
+void Dio_CommitBatch(void)
+{
+	Dio_PortType Port;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_COMMIT_BATCH_SID, DIO_E_UNINIT);
+	}
+	else
+#endif
+	{
+		for(Port = 0; Port < DIO_PORTS_NUMBER; Port++)
+		{
+			if(Dio_BatchMask[Port] != 0U)
+			{
+				/* The GPIODATA alias of the staged lanes leaves the other pins of the port untouched */
+				*DIO_DATA_MASKED_ADDRESS(Dio_PortBaseAddress[Port], Dio_BatchMask[Port]) = Dio_BatchLevel[Port];
+				Dio_BatchMask[Port] = 0U;
+			}
+			else
+			{
+				/* No Action Required */
+			}
+		}
+	}
 }
 #endif
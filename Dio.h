@@ -71,6 +71,7 @@
 
 /* Non AUTOSAR files */
 #include "Common_Macros.h"
+#include "Dio_Regs.h"
 
 /******************************************************************************
  *                      API Service Id Macros                                 *
@@ -102,6 +103,15 @@
 /* Service ID for DIO flip Channel */
 #define DIO_FLIP_CHANNEL_SID           (uint8)0x11
 
+/* Service ID for DIO begin batch (Not exist in AUTOSAR 4.0.3 DIO SWS Document) */
+#define DIO_BEGIN_BATCH_SID            (uint8)0x13
+
+/* Service ID for DIO batch write Channel (Not exist in AUTOSAR 4.0.3 DIO SWS Document) */
+#define DIO_BATCH_WRITE_CHANNEL_SID    (uint8)0x14
+
+/* Service ID for DIO commit batch (Not exist in AUTOSAR 4.0.3 DIO SWS Document) */
+#define DIO_COMMIT_BATCH_SID           (uint8)0x15
+
 /*******************************************************************************
  *                      DET Error Codes                                        *
  *******************************************************************************/
@@ -163,34 +173,95 @@ typedef struct
 	Dio_ChannelType Ch_Num;
 }Dio_ConfigChannel;
 
+/* Register data of a channel resolved once by Dio_Init and used by the channel APIs */
+typedef struct
+{
+	/* Address of the data register of the port that this channel belongs to
+	 * (the bit-band alias word of the channel bit when DIO_BITBAND_ACCESS is STD_ON) */
+	volatile uint32 * Data_Ptr;
+	/* Bit mask of the channel inside the data register */
+	uint32 Mask;
+	/* ID of the Port that this channel belongs to */
+	Dio_PortType Port_Num;
+}Dio_ChannelRegType;
+
 /* Data Structure required for initializing the Dio Driver */
 typedef struct Dio_ConfigType
 {
 	Dio_ConfigChannel Channels[DIO_CONFIGURED_CHANNLES];
+	Dio_ChannelGroupType Groups[DIO_CONFIGURED_CHANNEL_GROUPS];
 } Dio_ConfigType;
 
 /*******************************************************************************
  *                      Function Prototypes                                    *
  *******************************************************************************/
 
-/* Function for DIO read Channel API */
+/*
+ * Every channel/port/group API has two tiers:
+ * - The validated API (e.g. Dio_WriteChannel) performs the development error checks then does the access.
+ * - The _Fast API (e.g. Dio_WriteChannel_Fast) only does the access, it is meant for inner loops
+ *   where the caller already guarantees the driver is initialized and the parameters are valid.
+ */
+
+/* Function for DIO read Port API */
 Dio_PortLevelType Dio_ReadPort(Dio_PortType PortId);
 
-/* Function for DIO write Channel API */
+/* Function for DIO read Port API without development error checks */
+Dio_PortLevelType Dio_ReadPort_Fast(Dio_PortType PortId);
+
+/* Function for DIO write Port API */
 void Dio_WritePort(Dio_PortType PortId, Dio_PortLevelType Level);
 
-/* Function for DIO read Port API */
+/* Function for DIO write Port API without development error checks */
+void Dio_WritePort_Fast(Dio_PortType PortId, Dio_PortLevelType Level);
+
+/* Function for DIO read Channel API */
 Dio_LevelType Dio_ReadChannel(Dio_ChannelType ChannelId);
 
-/* Function for DIO write Port API */
+/* Function for DIO read Channel API without development error checks */
+Dio_LevelType Dio_ReadChannel_Fast(Dio_ChannelType ChannelId);
+
+/* Function for DIO write Channel API */
 void Dio_WriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level);
 
+/* Function for DIO write Channel API without development error checks */
+void Dio_WriteChannel_Fast(Dio_ChannelType ChannelId, Dio_LevelType Level);
+
+/* Function for DIO read Channel Group API */
+Dio_PortLevelType Dio_ReadChannelGroup(const Dio_ChannelGroupType *ChannelGroupIdPtr);
+
+/* Function for DIO read Channel Group API without development error checks */
+Dio_PortLevelType Dio_ReadChannelGroup_Fast(const Dio_ChannelGroupType *ChannelGroupIdPtr);
+
+/* Function for DIO write Channel Group API */
+void Dio_WriteChannelGroup(const Dio_ChannelGroupType *ChannelGroupIdPtr, Dio_PortLevelType Level);
+
+/* Function for DIO write Channel Group API without development error checks */
+void Dio_WriteChannelGroup_Fast(const Dio_ChannelGroupType *ChannelGroupIdPtr, Dio_PortLevelType Level);
+
 /* Function for DIO Initialization API */
 void Dio_Init(const Dio_ConfigType * ConfigPtr);
 
 #if (DIO_FLIP_CHANNEL_API == STD_ON)
 /* Function for DIO flip channel API */
 Dio_LevelType Dio_FlipChannel(Dio_ChannelType ChannelId);
+
+/* Function for DIO flip channel API without development error checks */
+Dio_LevelType Dio_FlipChannel_Fast(Dio_ChannelType ChannelId);
+#endif
+
+#if (DIO_BATCH_WRITE_API == STD_ON)
+/* Function to discard any staged channel levels and start a new batch */
+void Dio_BeginBatch(void);
+
+/* Function to stage the level of a channel in the current batch without touching the hardware */
+void Dio_BatchWriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level);
+
+/* Function to stage the level of a channel in the current batch without development error checks */
+void Dio_BatchWriteChannel_Fast(Dio_ChannelType ChannelId, Dio_LevelType Level);
+
+/* Function to write the staged levels with a single store per touched port */
+void Dio_CommitBatch(void);
 #endif
 
 /* Function for DIO Get Version Info API */
@@ -198,6 +269,31 @@ Dio_LevelType Dio_FlipChannel(Dio_ChannelType ChannelId);
 void Dio_GetVersionInfo(Std_VersionInfoType *versioninfo);
 #endif
 
+#if (DIO_STATIC_CHANNEL_API == STD_ON)
+/*
+ * Static channel accessors used by the Dio_WriteChannel_<Name>/Dio_ReadChannel_<Name>/Dio_FlipChannel_<Name>
+ * macros in Dio_Cfg.h. With constant arguments the masked GPIODATA alias and the pin mask fold to constants,
+ * so a write is a single store and a read is a single load.
+ */
+LOCAL_INLINE void Dio_WriteChannelStatic(Dio_PortType PortId, Dio_ChannelType ChannelNum, Dio_LevelType Level)
+{
+	*DIO_DATA_MASKED_ADDRESS(DIO_PORT_BASE_ADDRESS(PortId), ((uint32)1U << ChannelNum)) =
+	        (Level == STD_HIGH) ? ((uint32)1U << ChannelNum) : 0U;
+}
+
+LOCAL_INLINE Dio_LevelType Dio_ReadChannelStatic(Dio_PortType PortId, Dio_ChannelType ChannelNum)
+{
+	return (*DIO_DATA_MASKED_ADDRESS(DIO_PORT_BASE_ADDRESS(PortId), ((uint32)1U << ChannelNum)) != 0U) ? STD_HIGH : STD_LOW;
+}
+
+LOCAL_INLINE Dio_LevelType Dio_FlipChannelStatic(Dio_PortType PortId, Dio_ChannelType ChannelNum)
+{
+	Dio_LevelType output = (Dio_ReadChannelStatic(PortId, ChannelNum) == STD_HIGH) ? STD_LOW : STD_HIGH;
+	Dio_WriteChannelStatic(PortId, ChannelNum, output);
+	return output;
+}
+#endif
+
 /*******************************************************************************
  *                       External Variables                                    *
  *******************************************************************************/
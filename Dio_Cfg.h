@@ -35,6 +35,43 @@
 /* Pre-compile option for presence of Dio_FlipChannel API */
 #define DIO_FLIP_CHANNEL_API                (STD_ON)
 
+/* Pre-compile option for presence of the batched write APIs (Dio_BeginBatch/Dio_BatchWriteChannel/Dio_CommitBatch) */
+#define DIO_BATCH_WRITE_API                 (STD_ON)
+
+/*
+ * Pre-compile option for accessing each channel through its own masked GPIODATA alias:
+ * STD_ON  --> channel writes are single stores that only affect the channel pin (no read-modify-write)
+ * STD_OFF --> channel writes are read-modify-write on the whole port data register
+ */
+#ifndef DIO_MASKED_DATA_ACCESS
+#define DIO_MASKED_DATA_ACCESS              (STD_ON)
+#endif
+
+/*
+ * Ports accessed through the AHB aperture instead of the legacy APB one (bit n for port n, 0 --> PORTA .. 5 --> PORTF).
+ * Must have the same value as PORT_AHB_PORTS_MASK in Port_Cfg.h (checked by Dio.c), Port_Init enables these ports in GPIOHBCTL.
+ */
+#ifndef DIO_AHB_PORTS_MASK
+#define DIO_AHB_PORTS_MASK                  (0x20U) /* PORT F */
+#endif
+
+/*
+ * Pre-compile option for accessing each channel through the Cortex-M4 bit-band alias of its GPIODATA bit:
+ * STD_ON  --> channel read/write are single word accesses to the alias (0 or 1), flip is one read and one write
+ *             of the alias, it takes precedence over DIO_MASKED_DATA_ACCESS for the channel APIs
+ * STD_OFF --> channel APIs use the GPIODATA register selected by DIO_MASKED_DATA_ACCESS
+ */
+#ifndef DIO_BITBAND_ACCESS
+#define DIO_BITBAND_ACCESS                  (STD_OFF)
+#endif
+
+/*
+ * Pre-compile option for the static channel accessors (Dio_WriteChannel_<Name>/Dio_ReadChannel_<Name>/Dio_FlipChannel_<Name>).
+ * The port and pin of these channels are resolved at compile time so each access is a single load/store,
+ * they have no development error checks and must only be used after Port_Init.
+ */
+#define DIO_STATIC_CHANNEL_API              (STD_ON)
+
 /* Number of the configured Dio Channels */
 #define DIO_CONFIGURED_CHANNLES              (2U)
 
@@ -50,4 +87,27 @@
 #define DioConf_LED1_CHANNEL_NUM             (Dio_ChannelType)1 /* Pin 1 in PORTF */
 #define DioConf_SW1_CHANNEL_NUM              (Dio_ChannelType)4 /* Pin 4 in PORTF */
 
+/* DIO Configured Static Channel Accessors */
+#define Dio_WriteChannel_LED1(Level)         Dio_WriteChannelStatic(DioConf_LED1_PORT_NUM, DioConf_LED1_CHANNEL_NUM, (Level))
+#define Dio_ReadChannel_LED1()               Dio_ReadChannelStatic(DioConf_LED1_PORT_NUM, DioConf_LED1_CHANNEL_NUM)
+#define Dio_FlipChannel_LED1()               Dio_FlipChannelStatic(DioConf_LED1_PORT_NUM, DioConf_LED1_CHANNEL_NUM)
+#define Dio_WriteChannel_SW1(Level)          Dio_WriteChannelStatic(DioConf_SW1_PORT_NUM, DioConf_SW1_CHANNEL_NUM, (Level))
+#define Dio_ReadChannel_SW1()                Dio_ReadChannelStatic(DioConf_SW1_PORT_NUM, DioConf_SW1_CHANNEL_NUM)
+#define Dio_FlipChannel_SW1()                Dio_FlipChannelStatic(DioConf_SW1_PORT_NUM, DioConf_SW1_CHANNEL_NUM)
+
+/* Number of the configured Dio Channel Groups */
+#define DIO_CONFIGURED_CHANNEL_GROUPS        (1U)
+
+/* Channel Group Index in the array of structures in Dio_PBcfg.c */
+#define DioConf_LEDS_GROUP_ID_INDEX          (uint8)0x00
+
+/* DIO Configured Channel Group Port ID's */
+#define DioConf_LEDS_GROUP_PORT_NUM          (Dio_PortType)5 /* PORTF */
+
+/* DIO Configured Channel Group masks (positions of the group pins inside the port) */
+#define DioConf_LEDS_GROUP_MASK              (uint8)0x0E /* Pins 1, 2 and 3 in PORTF */
+
+/* DIO Configured Channel Group offsets (position of the group first pin from LSB) */
+#define DioConf_LEDS_GROUP_OFFSET            (uint8)1
+
 #endif /* DIO_CFG_H */
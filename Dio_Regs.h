@@ -14,11 +14,61 @@
 
 #include "Std_Types.h"
 
-#define GPIO_PORTA_DATA_REG       (*((volatile uint32 *)0x400043FC))
-#define GPIO_PORTB_DATA_REG       (*((volatile uint32 *)0x400053FC))
-#define GPIO_PORTC_DATA_REG       (*((volatile uint32 *)0x400063FC))
-#define GPIO_PORTD_DATA_REG       (*((volatile uint32 *)0x400073FC))
-#define GPIO_PORTE_DATA_REG       (*((volatile uint32 *)0x400243FC))
-#define GPIO_PORTF_DATA_REG       (*((volatile uint32 *)0x400253FC))
+/* Number of GPIO ports available on the TM4C123GH6PM (PORTA .. PORTF) */
+#define DIO_PORTS_NUMBER          (6U)
+
+/* GPIO ports base addresses (APB aperture) */
+#define DIO_PORTA_APB_BASE_ADDRESS    (0x40004000UL)
+#define DIO_PORTB_APB_BASE_ADDRESS    (0x40005000UL)
+#define DIO_PORTC_APB_BASE_ADDRESS    (0x40006000UL)
+#define DIO_PORTD_APB_BASE_ADDRESS    (0x40007000UL)
+#define DIO_PORTE_APB_BASE_ADDRESS    (0x40024000UL)
+#define DIO_PORTF_APB_BASE_ADDRESS    (0x40025000UL)
+
+/* GPIO ports base addresses (AHB aperture) */
+#define DIO_PORTA_AHB_BASE_ADDRESS    (0x40058000UL)
+#define DIO_PORTB_AHB_BASE_ADDRESS    (0x40059000UL)
+#define DIO_PORTC_AHB_BASE_ADDRESS    (0x4005A000UL)
+#define DIO_PORTD_AHB_BASE_ADDRESS    (0x4005B000UL)
+#define DIO_PORTE_AHB_BASE_ADDRESS    (0x4005C000UL)
+#define DIO_PORTF_AHB_BASE_ADDRESS    (0x4005D000UL)
+
+/* Aperture of each port used by Dio: AHB if the port is in DIO_AHB_PORTS_MASK (Dio_Cfg.h), APB otherwise */
+#define DIO_SELECT_BASE_ADDRESS(PORT, APB_ADDRESS, AHB_ADDRESS) \
+	(((DIO_AHB_PORTS_MASK & (1U << (PORT))) != 0U) ? (AHB_ADDRESS) : (APB_ADDRESS))
+
+#define DIO_PORTA_BASE_ADDRESS    DIO_SELECT_BASE_ADDRESS(0U, DIO_PORTA_APB_BASE_ADDRESS, DIO_PORTA_AHB_BASE_ADDRESS)
+#define DIO_PORTB_BASE_ADDRESS    DIO_SELECT_BASE_ADDRESS(1U, DIO_PORTB_APB_BASE_ADDRESS, DIO_PORTB_AHB_BASE_ADDRESS)
+#define DIO_PORTC_BASE_ADDRESS    DIO_SELECT_BASE_ADDRESS(2U, DIO_PORTC_APB_BASE_ADDRESS, DIO_PORTC_AHB_BASE_ADDRESS)
+#define DIO_PORTD_BASE_ADDRESS    DIO_SELECT_BASE_ADDRESS(3U, DIO_PORTD_APB_BASE_ADDRESS, DIO_PORTD_AHB_BASE_ADDRESS)
+#define DIO_PORTE_BASE_ADDRESS    DIO_SELECT_BASE_ADDRESS(4U, DIO_PORTE_APB_BASE_ADDRESS, DIO_PORTE_AHB_BASE_ADDRESS)
+#define DIO_PORTF_BASE_ADDRESS    DIO_SELECT_BASE_ADDRESS(5U, DIO_PORTF_APB_BASE_ADDRESS, DIO_PORTF_AHB_BASE_ADDRESS)
+
+/* Base address of the GPIO port with the given Port Id, folds to a constant when the Port Id is a constant */
+#define DIO_PORT_BASE_ADDRESS(PORT)  (((PORT) == 0U) ? DIO_PORTA_BASE_ADDRESS : \
+                                      ((PORT) == 1U) ? DIO_PORTB_BASE_ADDRESS : \
+                                      ((PORT) == 2U) ? DIO_PORTC_BASE_ADDRESS : \
+                                      ((PORT) == 3U) ? DIO_PORTD_BASE_ADDRESS : \
+                                      ((PORT) == 4U) ? DIO_PORTE_BASE_ADDRESS : DIO_PORTF_BASE_ADDRESS)
+
+/* Mask that selects all the 8 lanes of the GPIODATA register (0x3FC alias) */
+#define DIO_DATA_ALL_LANES_MASK   (0xFFU)
+
+/*
+ * GPIODATA is address-masked: bits [9:2] of the address select which lanes the access affects.
+ * Return a pointer to the GPIODATA alias of the port at BASE that only sees the lanes in MASK.
+ */
+#define DIO_DATA_MASKED_ADDRESS(BASE,MASK)  HW_REGISTER_ADDRESS((BASE) + ((uint32)(MASK) << 2))
+
+/* Cortex-M4 peripheral bit-band region and its alias region */
+#define DIO_BITBAND_PERIPHERAL_BASE   (0x40000000UL)
+#define DIO_BITBAND_ALIAS_BASE        (0x42000000UL)
+
+/*
+ * Return a pointer to the bit-band alias word of bit BIT of the peripheral register at REG_ADDRESS:
+ * reading the word returns the bit (0 or 1) and writing 0 or 1 to it changes only that bit in one bus transaction.
+ */
+#define DIO_BITBAND_ADDRESS(REG_ADDRESS,BIT) \
+	HW_REGISTER_ADDRESS(DIO_BITBAND_ALIAS_BASE + (((uint32)(REG_ADDRESS) - DIO_BITBAND_PERIPHERAL_BASE) << 5) + ((uint32)(BIT) << 2))
 
 #endif /* DIO_REGS_H */
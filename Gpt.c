@@ -10,12 +10,21 @@
  ******************************************************************************/
 
 #include "Gpt.h"
+#include "Mcu.h"
 #include "tm4c123gh6pm_registers.h"
 
 #define SYSTICK_PRIORITY_MASK  0x1FFFFFFF
-#define SYSTICK_INTERRUPT_PRIORITY  3
 #define SYSTICK_PRIORITY_BITS_POS   29
 
+/* Number of milliseconds in one second */
+#define SYSTICK_MS_PER_SECOND       1000
+
+/* SysTick counter is 24 bits wide */
+#define SYSTICK_MAX_RELOAD          0x00FFFFFF
+
+/* COUNTFLAG bit of the SysTick Control Register */
+#define SYSTICK_COUNTFLAG_MASK      0x00010000
+
 /* Global pointer to function used to point upper layer functions
  * to be used in Call Back */
 static void (*g_SysTick_Call_Back_Ptr)(void) = NULL_PTR;
@@ -43,14 +52,21 @@ void SysTick_Handler(void)
 * Parameters (out): None
 * Return value: None
 * Description: Function to Setup the SysTick Timer configuration to count n miliseconds:
-*              - Set the Reload value
-*              - Enable SysTick Timer with System clock 16Mhz
+*              - Set the Reload value from the core frequency given by the Mcu driver
+*              - Enable SysTick Timer with System clock
 *              - Enable SysTick Timer Interrupt and set its priority
+*              Tick_Time is limited to SysTick_GetMaxPeriod().
 ************************************************************************************/
-void SysTick_Start(uint16 Tick_Time)
+void SysTick_Start(uint32 Tick_Time)
 {
+    /* The 24-bit counter can not count a longer period */
+    if(Tick_Time > SysTick_GetMaxPeriod())
+    {
+        Tick_Time = SysTick_GetMaxPeriod();
+    }
+
     SYSTICK_CTRL_REG    = 0;                         /* Disable the SysTick Timer by Clear the ENABLE Bit */
-    SYSTICK_RELOAD_REG  = 15999 * Tick_Time;         /* Set the Reload value to count n miliseconds */
+    SYSTICK_RELOAD_REG  = ((Mcu_GetCoreFrequency() / SYSTICK_MS_PER_SECOND) * Tick_Time) - 1; /* Set the Reload value to count n miliseconds */
     SYSTICK_CURRENT_REG = 0;                         /* Clear the Current Register value */
     /* Configure the SysTick Control Register 
      * Enable the SysTick Timer (ENABLE = 1)
@@ -90,3 +106,65 @@ void SysTick_SetCallBack(void(*Ptr2Func)(void))
 {
     g_SysTick_Call_Back_Ptr = Ptr2Func;
 }
+
+/************************************************************************************
+* Service Name: SysTick_SetNextPeriod
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Tick_Time - Time in miliseconds
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to set the period of the SysTick Timer from its next reload:
+*              the running period is not affected so the time base does not drift.
+*              Tick_Time must not exceed SysTick_GetMaxPeriod().
+************************************************************************************/
+void SysTick_SetNextPeriod(uint32 Tick_Time)
+{
+    SYSTICK_RELOAD_REG = ((Mcu_GetCoreFrequency() / SYSTICK_MS_PER_SECOND) * Tick_Time) - 1;
+}
+
+/************************************************************************************
+* Service Name: SysTick_GetMaxPeriod
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - Longest SysTick period in miliseconds at the current core clock
+* Description: Function to get the longest period the 24-bit SysTick Timer can count.
+************************************************************************************/
+uint32 SysTick_GetMaxPeriod(void)
+{
+    return (SYSTICK_MAX_RELOAD + 1) / (Mcu_GetCoreFrequency() / SYSTICK_MS_PER_SECOND);
+}
+
+/************************************************************************************
+* Service Name: SysTick_GetCounter
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - Current value of the SysTick down counter in core clock cycles
+* Description: Function to read the SysTick current value register.
+************************************************************************************/
+uint32 SysTick_GetCounter(void)
+{
+    return SYSTICK_CURRENT_REG;
+}
+
+/************************************************************************************
+* Service Name: SysTick_GetCountFlag
+* Sync/Async: Synchronous
+* Reentrancy: non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: boolean - TRUE if the counter reached 0 since the last call
+* Description: Function to read and clear the COUNTFLAG of the SysTick Timer.
+************************************************************************************/
+boolean SysTick_GetCountFlag(void)
+{
+    return ((SYSTICK_CTRL_REG & SYSTICK_COUNTFLAG_MASK) != 0) ? TRUE : FALSE;
+}
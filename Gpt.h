@@ -14,6 +14,13 @@
 
 #include "Std_Types.h"
 
+/*******************************************************************************
+ *                              Module Definitions                             *
+ *******************************************************************************/
+
+/* Priority of the SysTick interrupt (0 is the highest), the Os checks the GPIO interrupts against it */
+#define SYSTICK_INTERRUPT_PRIORITY  3
+
 /*******************************************************************************
  *                      Function Prototypes                                    *
  *******************************************************************************/
@@ -27,11 +34,12 @@
 * Parameters (out): None
 * Return value: None
 * Description: Function to Setup the SysTick Timer configuration to count n miliseconds:
-*              - Set the Reload value
-*              - Enable SysTick Timer with System clock 16Mhz
+*              - Set the Reload value from the core frequency given by the Mcu driver
+*              - Enable SysTick Timer with System clock
 *              - Enable SysTick Timer Interrupt and set its priority
+*              Tick_Time is limited to SysTick_GetMaxPeriod().
 ************************************************************************************/	
-void SysTick_Start(uint16 Tick_Time);
+void SysTick_Start(uint32 Tick_Time);
 
 /************************************************************************************
 * Service Name: SysTick_Stop
@@ -57,4 +65,52 @@ void SysTick_Stop(void);
 ************************************************************************************/
 void SysTick_SetCallBack(void (*Ptr2Func)(void));
 
+/************************************************************************************
+* Service Name: SysTick_SetNextPeriod
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Tick_Time - Time in miliseconds
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to set the period of the SysTick Timer from its next reload.
+************************************************************************************/
+void SysTick_SetNextPeriod(uint32 Tick_Time);
+
+/************************************************************************************
+* Service Name: SysTick_GetMaxPeriod
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - Longest SysTick period in miliseconds at the current core clock
+* Description: Function to get the longest period the 24-bit SysTick Timer can count.
+************************************************************************************/
+uint32 SysTick_GetMaxPeriod(void);
+
+/************************************************************************************
+* Service Name: SysTick_GetCounter
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - Current value of the SysTick down counter in core clock cycles
+* Description: Function to read the SysTick current value register.
+************************************************************************************/
+uint32 SysTick_GetCounter(void);
+
+/************************************************************************************
+* Service Name: SysTick_GetCountFlag
+* Sync/Async: Synchronous
+* Reentrancy: non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: boolean - TRUE if the counter reached 0 since the last call
+* Description: Function to read and clear the COUNTFLAG of the SysTick Timer.
+************************************************************************************/
+boolean SysTick_GetCountFlag(void);
+
 #endif /* GPT_H */
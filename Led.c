@@ -29,13 +29,21 @@
 /*********************************************************************************************/
 void Led_SetOn(void)
 {
+#if (DIO_STATIC_CHANNEL_API == STD_ON)
+    Dio_WriteChannel_LED1(LED_ON);                           /* LED ON */
+#else
     Dio_WriteChannel(DioConf_LED1_CHANNEL_ID_INDEX,LED_ON);  /* LED ON */
+#endif
 }
 
 /*********************************************************************************************/
 void Led_SetOff(void)
 {
+#if (DIO_STATIC_CHANNEL_API == STD_ON)
+    Dio_WriteChannel_LED1(LED_OFF);                          /* LED OFF */
+#else
     Dio_WriteChannel(DioConf_LED1_CHANNEL_ID_INDEX,LED_OFF); /* LED OFF */
+#endif
 }
 
 /*********************************************************************************************/
@@ -48,7 +56,18 @@ void Led_RefreshOutput(void)
 /*********************************************************************************************/
 void Led_Toggle(void)
 {
-    Dio_LevelType state = Dio_FlipChannel(DioConf_LED1_CHANNEL_ID_INDEX);
+#if (DIO_FLIP_CHANNEL_API == STD_ON)
+    (void)Dio_FlipChannel(DioConf_LED1_CHANNEL_ID_INDEX); /* flip only the LED pin through its Dio channel */
+#else
+    if(Dio_ReadChannel(DioConf_LED1_CHANNEL_ID_INDEX) == LED_ON)
+    {
+        Dio_WriteChannel(DioConf_LED1_CHANNEL_ID_INDEX,LED_OFF); /* LED OFF */
+    }
+    else
+    {
+        Dio_WriteChannel(DioConf_LED1_CHANNEL_ID_INDEX,LED_ON);  /* LED ON */
+    }
+#endif
 }
 
 /*********************************************************************************************/
@@ -9,11 +9,87 @@
  * Author: Tarek Emad
  ******************************************************************************/
 
+#include "Mcu.h"
 #include "tm4c123gh6pm_registers.h"
 
+/* RCC register bits */
+#define MCU_RCC_MOSCDIS_MASK        (0x00000001UL)
+#define MCU_RCC_XTAL_MASK           (0x000007C0UL)
+#define MCU_RCC_XTAL_POS            6
+#define MCU_RCC_USESYSDIV_MASK      (0x00400000UL)
+
+/* RCC2 register bits */
+#define MCU_RCC2_OSCSRC2_MASK       (0x00000070UL)
+#define MCU_RCC2_BYPASS2_MASK       (0x00000800UL)
+#define MCU_RCC2_PWRDN2_MASK        (0x00002000UL)
+#define MCU_RCC2_SYSDIV2_MASK       (0x1FC00000UL)
+#define MCU_RCC2_SYSDIV2_POS        22
+#define MCU_RCC2_DIV400_MASK        (0x40000000UL)
+#define MCU_RCC2_USERCC2_MASK       (0x80000000UL)
+
+/* RIS register PLL lock bit */
+#define MCU_RIS_PLLLRIS_MASK        (0x00000040UL)
+
+/* Current core clock frequency, the device starts on the PIOSC */
+static uint32 g_Mcu_Core_Frequency = MCU_PIOSC_FREQUENCY_HZ;
+
+/************************************************************************************
+* Service Name: Mcu_Init
+* Sync/Async: Synchronous
+* Reentrancy: non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to configure the system clock and enable the GPIO ports clock:
+*              - Bypass the PLL while it is configured (RCC2 overrides RCC)
+*              - Select the crystal and the main oscillator then power up the PLL
+*              - Set the 400 MHz divisor and wait for the PLL to lock
+*              - Drive the system clock from the PLL
+************************************************************************************/
 void Mcu_Init(void)
 {
+#if (MCU_PLL_ENABLE == STD_ON)
+    /* Use RCC2 fields and run from the raw oscillator while the PLL is being configured */
+    SYSCTL_RCC2_REG |= MCU_RCC2_USERCC2_MASK;
+    SYSCTL_RCC2_REG |= MCU_RCC2_BYPASS2_MASK;
+
+    /* Select the crystal value and enable the main oscillator as the clock source */
+    SYSCTL_RCC_REG   = (SYSCTL_RCC_REG & ~(MCU_RCC_XTAL_MASK | MCU_RCC_MOSCDIS_MASK)) | ((uint32)MCU_XTAL_VALUE << MCU_RCC_XTAL_POS);
+    SYSCTL_RCC2_REG &= ~MCU_RCC2_OSCSRC2_MASK;
+
+    /* Power up the PLL */
+    SYSCTL_RCC2_REG &= ~MCU_RCC2_PWRDN2_MASK;
+
+    /* Use the 400 MHz PLL output and set the system clock divisor */
+    SYSCTL_RCC2_REG |= MCU_RCC2_DIV400_MASK;
+    SYSCTL_RCC2_REG  = (SYSCTL_RCC2_REG & ~MCU_RCC2_SYSDIV2_MASK) | ((uint32)MCU_PLL_SYSDIV << MCU_RCC2_SYSDIV2_POS);
+    SYSCTL_RCC_REG  |= MCU_RCC_USESYSDIV_MASK;
+
+    /* Wait until the PLL is locked */
+    while(!(SYSCTL_RIS_REG & MCU_RIS_PLLLRIS_MASK));
+
+    /* Drive the system clock from the PLL */
+    SYSCTL_RCC2_REG &= ~MCU_RCC2_BYPASS2_MASK;
+#endif
+    g_Mcu_Core_Frequency = MCU_CORE_FREQUENCY_HZ;
+
     /* Enable clock for All PORTs and wait for clock to start */
     SYSCTL_RCGCGPIO_REG |= 0x3F;
     while(!(SYSCTL_PRGPIO_REG & 0x3F));
 }
+
+/************************************************************************************
+* Service Name: Mcu_GetCoreFrequency
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - Current core clock frequency in Hz
+* Description: Function to get the current core clock frequency.
+************************************************************************************/
+uint32 Mcu_GetCoreFrequency(void)
+{
+    return g_Mcu_Core_Frequency;
+}
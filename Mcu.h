@@ -14,7 +14,39 @@
 #define MCU_H_
 
 #include "Std_Types.h"
+#include "Mcu_Cfg.h"
 
+/* Core (system) clock frequency in Hz resulting from the Mcu configuration */
+#if (MCU_PLL_ENABLE == STD_ON)
+#define MCU_CORE_FREQUENCY_HZ   (MCU_PLL_FREQUENCY_HZ / (MCU_PLL_SYSDIV + 1U))
+#else
+#define MCU_CORE_FREQUENCY_HZ   (MCU_PIOSC_FREQUENCY_HZ)
+#endif
+
+/************************************************************************************
+* Service Name: Mcu_Init
+* Sync/Async: Synchronous
+* Reentrancy: non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to configure the system clock from Mcu_Cfg.h (PLL, crystal and
+*              divisor) and to enable the clock of all the GPIO ports.
+************************************************************************************/
 void Mcu_Init(void);
 
+/************************************************************************************
+* Service Name: Mcu_GetCoreFrequency
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - Current core clock frequency in Hz
+* Description: Function to get the current core clock frequency, the PIOSC frequency
+*              before Mcu_Init and MCU_CORE_FREQUENCY_HZ after it.
+************************************************************************************/
+uint32 Mcu_GetCoreFrequency(void);
+
 #endif /* MCU_H_ */
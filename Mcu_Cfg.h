@@ -0,0 +1,42 @@
+/******************************************************************************
+ *
+ * Module: Mcu
+ *
+ * File Name: Mcu_Cfg.h
+ *
+ * Description: Header file for Pre-Compiler configuration used by Mcu Module
+ *
+ * Author: Tarek Emad
+ ******************************************************************************/
+
+#ifndef MCU_CFG_H_
+#define MCU_CFG_H_
+
+/*
+ * Pre-compile option for the system clock source:
+ * STD_ON  --> the system clock is driven by the PLL (400 MHz) divided by MCU_PLL_SYSDIV
+ * STD_OFF --> the system clock stays on the precision internal oscillator (PIOSC)
+ */
+#define MCU_PLL_ENABLE                (STD_ON)
+
+/* Frequency of the precision internal oscillator (PIOSC) in Hz */
+#define MCU_PIOSC_FREQUENCY_HZ        (16000000UL)
+
+/* Frequency of the PLL output used with DIV400 in Hz */
+#define MCU_PLL_FREQUENCY_HZ          (400000000UL)
+
+/* RCC XTAL field value of the crystal on the main oscillator (0x15 --> 16 MHz crystal of the LaunchPad) */
+#define MCU_XTAL_VALUE                (0x15U)
+
+/*
+ * 7-bit system clock divisor (SYSDIV2:SYSDIV2LSB of RCC2) applied to the 400 MHz PLL output:
+ * system clock = 400 MHz / (MCU_PLL_SYSDIV + 1), 4 --> 80 MHz (the maximum of the TM4C123GH6PM)
+ */
+#define MCU_PLL_SYSDIV                (4U)
+
+/* A divisor below 4 runs the device above its 80 MHz maximum */
+#if ((MCU_PLL_ENABLE == STD_ON) && (MCU_PLL_SYSDIV < 4U))
+  #error "MCU_PLL_SYSDIV must be at least 4, the system clock can not exceed 80 MHz"
+#endif
+
+#endif /* MCU_CFG_H_ */
@@ -14,7 +14,15 @@
 #include "Button.h"
 #include "Led.h"
 #include "Gpt.h"
+#include "Mcu.h"
+#include "Port_Cfg.h"
+#include "tm4c123gh6pm_registers.h"
 
+/*
+ * Cortex-M instructions of the kernel. An off-target build can define OS_HOST_PORT before this
+ * file is included to provide them (and the context switch of the preemptive mode) itself.
+ */
+#ifndef OS_HOST_PORT
 /* Enable Exceptions ... This Macro enable IRQ interrupts, Programmable Systems Exceptions and Faults by clearing the I-bit in the PRIMASK. */
 #define Enable_Exceptions()    __asm(" CPSIE I ")
 
@@ -27,17 +35,595 @@
 /* Disable Faults ... This Macro disable Faults by setting the F-bit in the FAULTMASK */
 #define Disable_Faults()       __asm(" CPSID F ")
 
-/* Global variable store the Os Time */
-static uint8 g_Time_Tick_Count = 0;
+/* Wait For Interrupt ... This Macro puts the CPU in sleep mode until an interrupt is pending, even if it is masked by PRIMASK */
+#define Wait_For_Interrupt()   __asm(" WFI ")
+#endif
+
+/* Number of the tasks in the task table */
+#define OS_TASK_COUNT(FUNC, PERIOD, OFFSET, BUDGET, CRITICAL)   + 1U
+#define OS_TASKS_NUMBER                               (0U OS_TASKS_LIST(OS_TASK_COUNT))
+
+/* Number of the minor frames in the major frame */
+#define OS_FRAMES_NUMBER                              (OS_HYPERPERIOD / OS_BASE_TIME)
+
+/* Check the task table at compile time */
+#define OS_TASK_INVALID(FUNC, PERIOD, OFFSET, BUDGET, CRITICAL) \
+    || (((PERIOD) % OS_BASE_TIME) != 0) || ((OS_HYPERPERIOD % (PERIOD)) != 0) || \
+       (((OFFSET) % OS_BASE_TIME) != 0) || ((OFFSET) >= (PERIOD))
+
+#if ((OS_HYPERPERIOD % OS_BASE_TIME) != 0)
+#error "OS_HYPERPERIOD must be a multiple of OS_BASE_TIME"
+#endif
+
+#if (0 OS_TASKS_LIST(OS_TASK_INVALID))
+#error "Each task period must be a multiple of OS_BASE_TIME dividing OS_HYPERPERIOD, with an offset multiple of OS_BASE_TIME below the period"
+#endif
+
+#if ((OS_TASKS_NUMBER == 0U) || (OS_TASKS_NUMBER > 32U))
+#error "The task table must contain from 1 to 32 tasks"
+#endif
+
+#if ((OS_PREEMPTIVE == STD_ON) && (OS_TASK_PROFILING == STD_ON))
+#error "The task profiler measures the time from the entry to the exit of a task, it is only supported by the cooperative mode"
+#endif
+
+#if ((OS_PREEMPTIVE == STD_ON) && (((OS_TASK_STACK_SIZE % 8U) != 0U) || (OS_TASK_STACK_SIZE < 256U)))
+#error "OS_TASK_STACK_SIZE must be a multiple of 8 of at least 256 bytes"
+#endif
+
+#if ((OS_OVERLOAD_POLICY != OS_OVERLOAD_SKIP) && (OS_OVERLOAD_POLICY != OS_OVERLOAD_CATCH_UP) && (OS_OVERLOAD_POLICY != OS_OVERLOAD_DEGRADE))
+#error "OS_OVERLOAD_POLICY must be OS_OVERLOAD_SKIP, OS_OVERLOAD_CATCH_UP or OS_OVERLOAD_DEGRADE"
+#endif
+
+/* Task table entry of one task */
+#define OS_TASK_ENTRY(FUNC, PERIOD, OFFSET, BUDGET, CRITICAL)   {FUNC, PERIOD, OFFSET, BUDGET, CRITICAL},
+
+/* Static task table */
+static const Os_TaskConfigType g_Os_Tasks[OS_TASKS_NUMBER] = {
+    OS_TASKS_LIST(OS_TASK_ENTRY)
+};
+
+/* Tasks released in each minor frame (bit n for the task n of the table), generated by Os_BuildSchedule */
+static uint32 g_Os_Frame_Tasks[OS_FRAMES_NUMBER];
+
+/* Number of minor frames from each minor frame to the next one releasing a task, used by the tickless mode */
+static uint16 g_Os_Frame_Skip[OS_FRAMES_NUMBER];
+
+/* Rate monotonic utilization bound n(2^(1/n) - 1) in per mille for n = 1 to 10 tasks, ln(2) above */
+#define OS_RM_BOUNDS_NUMBER   (10U)
+#define OS_RM_BOUND_LIMIT     (693U)
+static const uint16 g_Os_Rm_Bounds[OS_RM_BOUNDS_NUMBER] = {1000U, 828U, 779U, 756U, 743U, 734U, 728U, 724U, 720U, 717U};
+
+/* Frames number and worst case frame load of the generated schedule */
+static Os_ScheduleInfoType g_Os_Schedule_Info;
+
+/* Ticks, wakeups and idle time since the Os timer started */
+static Os_IdleStatsType g_Os_Idle_Stats;
+
+/* Global variable store the index of the current minor frame in the major frame */
+static volatile uint16 g_Frame_Index = 0;
+
+/* Number of minor frames reached since the Os timer started (g_Frame_Index is this number modulo OS_FRAMES_NUMBER) */
+static volatile uint32 g_Frame_Counter = 0;
+
+#if (OS_PREEMPTIVE == STD_OFF)
+/* Number of the last minor frame handled by the scheduler */
+static uint32 g_Dispatched_Frame_Counter = 0;
+#endif
+
+/* Global variable to indicate that the scheduler is running the tasks of a frame */
+static volatile uint8 g_Frame_Running_Flag = 0;
+
+/* Global variable to indicate that a tick came while a frame was running, cleared by the scheduler */
+static volatile uint8 g_Overrun_Flag = 0;
+
+/* Tasks marked critical in the task table (bit n for the task n of the table) */
+static uint32 g_Os_Critical_Tasks = 0;
+
+/* Overruns, late frames and missed activations since the Os timer started */
+static Os_OverloadStatsType g_Os_Overload_Stats;
 
 /* Global variable to indicate the the timer has a new tick */
-static uint8 g_New_Time_Tick_Flag = 0;
+static volatile uint8 g_New_Time_Tick_Flag = 0;
+
+#if (OS_PREEMPTIVE == STD_OFF)
+/* Tasks released by Os_ActivateTask and not run yet (bit n for the task n of the table) */
+static volatile uint32 g_Os_Event_Tasks = 0;
+#endif
+
+#if (OS_TICKLESS == STD_ON)
+/* Minor frame reached at the end of the running SysTick period */
+static uint16 g_Next_Frame_Index = 0;
+#endif
+
+/* Core clock cycles in one minor frame */
+static uint32 g_Frame_Cycles = 0;
+
+/* Core clock cycles of the running SysTick period */
+static volatile uint32 g_Period_Cycles = 0;
+
+#if (OS_PREEMPTIVE == STD_ON)
+/* Set PENDSVSET in the Interrupt Control and State register to request a context switch */
+#define OS_PENDSV_SET_MASK              (0x10000000U)
+
+/* PendSV runs at the lowest priority so it never preempts an interrupt */
+#define OS_PENDSV_PRIORITY_MASK         (0xFF1FFFFFU)
+#define OS_PENDSV_INTERRUPT_PRIORITY    (7U)
+#define OS_PENDSV_PRIORITY_BITS_POS     (21U)
+
+/* The tick and the GPIO notifications (Os_ActivateTask) release the tasks before PendSV switches to them */
+#if ((PORT_PIN_EDGE_NOTIFICATION_API == STD_ON) && \
+     ((PORT_GPIO_INTERRUPT_PRIORITY <= SYSTICK_INTERRUPT_PRIORITY) || (PORT_GPIO_INTERRUPT_PRIORITY >= OS_PENDSV_INTERRUPT_PRIORITY)))
+#error "PORT_GPIO_INTERRUPT_PRIORITY must be below the SysTick priority and above the PendSV priority"
+#endif
+
+/* Initial xPSR of a task, only the Thumb bit is set */
+#define OS_INITIAL_XPSR                 (0x01000000U)
+
+/* EXC_RETURN to the thread mode using the process stack without floating point context */
+#define OS_EXC_RETURN_THREAD_PSP        (0xFFFFFFFDU)
+
+/* Priority of the idle loop, below the priority of every task */
+#define OS_IDLE_PRIORITY                (OS_TASKS_NUMBER)
+
+/* Size of each stack in 8 bytes units, the stacks are 8 bytes aligned as required by the AAPCS */
+#define OS_STACK_UNITS                  (OS_TASK_STACK_SIZE / 8U)
+
+/* Task control block, Sp must stay the first member as it is accessed by PendSV_Handler */
+typedef struct
+{
+    uint32 *Sp;     /* Saved process stack pointer of the task */
+    uint8  Task;    /* Index of the task in the table */
+} Os_TcbType;
+
+/* Control block of the task of each priority (0 is the highest), the last one is the idle loop */
+static Os_TcbType g_Os_Tcbs[OS_TASKS_NUMBER + 1U];
+
+/* Stack of the task of each priority, the last one is the idle loop stack */
+static uint64 g_Os_Stacks[OS_TASKS_NUMBER + 1U][OS_STACK_UNITS];
+
+/* Tasks released in each minor frame (bit n for the priority n) */
+static uint32 g_Os_Frame_Priorities[OS_FRAMES_NUMBER];
+
+/* Priority of each task of the table */
+static uint8 g_Os_Task_Priority[OS_TASKS_NUMBER];
+
+/* Tasks released and not finished yet (bit n for the priority n) */
+static volatile uint32 g_Os_Ready_Mask = 0;
+
+/* Tasks of g_Os_Ready_Mask released by Os_ActivateTask only, their frame release is not an overrun */
+static volatile uint32 g_Os_Event_Ready_Mask = 0;
+
+/* Running task and task selected by the last dispatch, not static as they are used by PendSV_Handler */
+Os_TcbType * volatile g_Os_Current_Tcb = &g_Os_Tcbs[OS_IDLE_PRIORITY];
+Os_TcbType * volatile g_Os_Next_Tcb = &g_Os_Tcbs[OS_IDLE_PRIORITY];
+
+/* The idle loop sleeps only if no task is ready */
+#define OS_IDLE_CONDITION()             (g_Os_Ready_Mask == 0U)
+
+/*
+ * PendSV_Handler: save the context of the running task on its stack (R4-R11, EXC_RETURN and
+ * S16-S31 if the task used the FPU, the rest is stacked by the hardware) then restore the
+ * context of g_Os_Next_Tcb.
+ * Os_StartIdle(Stack_Top, Idle_Func): move the thread mode to the process stack at Stack_Top,
+ * enable the interrupts and jump to Idle_Func, it never returns.
+ */
+#ifndef OS_HOST_PORT
+__asm("    .thumb\n"
+      "    .text\n"
+      "    .global PendSV_Handler\n"
+      "    .global Os_StartIdle\n"
+      "PendSV_Handler: .asmfunc\n"
+      "    MRS      R0, PSP\n"
+      "    ISB\n"
+      "    TST      LR, #0x10\n"
+      "    IT       EQ\n"
+      "    VSTMDBEQ R0!, {S16-S31}\n"
+      "    STMDB    R0!, {R4-R11, LR}\n"
+      "    CPSID    I\n"
+      "    LDR      R3, Os_Current_Tcb_Addr\n"
+      "    LDR      R2, [R3]\n"
+      "    STR      R0, [R2]\n"
+      "    LDR      R1, Os_Next_Tcb_Addr\n"
+      "    LDR      R1, [R1]\n"
+      "    STR      R1, [R3]\n"
+      "    LDR      R0, [R1]\n"
+      "    CPSIE    I\n"
+      "    LDMIA    R0!, {R4-R11, LR}\n"
+      "    TST      LR, #0x10\n"
+      "    IT       EQ\n"
+      "    VLDMIAEQ R0!, {S16-S31}\n"
+      "    MSR      PSP, R0\n"
+      "    ISB\n"
+      "    BX       LR\n"
+      "    .endasmfunc\n"
+      "Os_StartIdle: .asmfunc\n"
+      "    MSR      PSP, R0\n"
+      "    MOVS     R2, #2\n"
+      "    MSR      CONTROL, R2\n"
+      "    ISB\n"
+      "    CPSIE    I\n"
+      "    BX       R1\n"
+      "    .endasmfunc\n"
+      "    .align   4\n"
+      "Os_Current_Tcb_Addr: .word g_Os_Current_Tcb\n"
+      "Os_Next_Tcb_Addr:    .word g_Os_Next_Tcb\n");
+#endif
+
+/* Exception handler of the context switch, installed in the vector table */
+void PendSV_Handler(void);
+
+/* Move to the idle stack and run the idle loop */
+void Os_StartIdle(uint32 *Stack_Top, void (*Idle_Func)(void));
+#else
+/* The idle loop sleeps only if no tick and no event is pending */
+#define OS_IDLE_CONDITION()             ((g_New_Time_Tick_Flag == 0) && (g_Os_Event_Tasks == 0U))
+#endif
+
+#if (OS_TASK_PROFILING == STD_ON)
+/* Execution time and start latency statistics of each task of the table */
+static Os_TaskStatsType g_Os_Task_Stats[OS_TASKS_NUMBER];
+
+/* Sum of the execution time of each task in core clock cycles */
+static uint64 g_Os_Task_Exec_Total[OS_TASKS_NUMBER];
+
+/* Sum of the execution time of all the tasks in core clock cycles */
+static uint64 g_Os_Busy_Cycles = 0;
+#endif
+
+/*********************************************************************************************/
+/* Description: Generate the tasks released in each minor frame from the task table,
+ *              the minor frame n starts at n * OS_BASE_TIME (frame 0 is the end of the major frame) */
+static void Os_BuildSchedule(void)
+{
+    uint16 Frame;
+    uint8 Task;
+    uint8 Tasks_Count;
+    uint32 Frame_Budget;
+    uint16 Skip;
+    uint32 Max_Skip;
+    uint32 Hyperperiod_Budget = 0;
+
+    g_Os_Schedule_Info.Frames_Number       = OS_FRAMES_NUMBER;
+    g_Os_Schedule_Info.Max_Tasks_Per_Frame = 0;
+    g_Os_Schedule_Info.Worst_Frame_Budget  = 0;
+
+    g_Os_Critical_Tasks = 0;
+    for(Task = 0; Task < OS_TASKS_NUMBER; Task++)
+    {
+        if(g_Os_Tasks[Task].Critical == STD_ON)
+        {
+            g_Os_Critical_Tasks |= ((uint32)1 << Task);
+        }
+        /* Budget of all the releases of the task in the major frame in us */
+        Hyperperiod_Budget += (uint32)g_Os_Tasks[Task].Budget * (OS_HYPERPERIOD / g_Os_Tasks[Task].Period);
+    }
+
+    /* Utilization in per mille of the major frame (OS_HYPERPERIOD ms = OS_HYPERPERIOD * 1000 us) */
+    g_Os_Schedule_Info.Utilization = (uint16)(Hyperperiod_Budget / OS_HYPERPERIOD);
+    g_Os_Schedule_Info.Rm_Schedulable =
+        (g_Os_Schedule_Info.Utilization <= ((OS_TASKS_NUMBER <= OS_RM_BOUNDS_NUMBER) ? g_Os_Rm_Bounds[OS_TASKS_NUMBER - 1U] : OS_RM_BOUND_LIMIT)) ? TRUE : FALSE;
+
+    for(Frame = 0; Frame < OS_FRAMES_NUMBER; Frame++)
+    {
+        g_Os_Frame_Tasks[Frame] = 0;
+        Tasks_Count  = 0;
+        Frame_Budget = 0;
+
+        for(Task = 0; Task < OS_TASKS_NUMBER; Task++)
+        {
+            if((((uint32)Frame * OS_BASE_TIME + OS_HYPERPERIOD - g_Os_Tasks[Task].Offset) % g_Os_Tasks[Task].Period) == 0)
+            {
+                g_Os_Frame_Tasks[Frame] |= ((uint32)1 << Task);
+                Tasks_Count++;
+                Frame_Budget += g_Os_Tasks[Task].Budget;
+            }
+        }
+
+        if(Tasks_Count > g_Os_Schedule_Info.Max_Tasks_Per_Frame)
+        {
+            g_Os_Schedule_Info.Max_Tasks_Per_Frame = Tasks_Count;
+        }
+        if(Frame_Budget > g_Os_Schedule_Info.Worst_Frame_Budget)
+        {
+            g_Os_Schedule_Info.Worst_Frame_Budget = Frame_Budget;
+        }
+    }
+
+    /* Load of the worst frame in percent of the minor frame duration (OS_BASE_TIME ms = OS_BASE_TIME * 1000 us) */
+    g_Os_Schedule_Info.Worst_Frame_Load = (uint8)((g_Os_Schedule_Info.Worst_Frame_Budget * 100U) / ((uint32)OS_BASE_TIME * 1000U));
+
+    /* Frames to skip from each frame to the next one with tasks, limited to the longest SysTick period */
+    Max_Skip = SysTick_GetMaxPeriod() / OS_BASE_TIME;
+    if(Max_Skip > OS_FRAMES_NUMBER)
+    {
+        Max_Skip = OS_FRAMES_NUMBER;
+    }
+    for(Frame = 0; Frame < OS_FRAMES_NUMBER; Frame++)
+    {
+        Skip = 1;
+        while((Skip < Max_Skip) && (g_Os_Frame_Tasks[(Frame + Skip) % OS_FRAMES_NUMBER] == 0))
+        {
+            Skip++;
+        }
+        g_Os_Frame_Skip[Frame] = Skip;
+    }
+
+    g_Frame_Cycles = (Mcu_GetCoreFrequency() / 1000U) * OS_BASE_TIME;
+#if (OS_TICKLESS == STD_ON)
+    g_Period_Cycles = g_Frame_Cycles * g_Os_Frame_Skip[0];
+#else
+    g_Period_Cycles = g_Frame_Cycles;
+#endif
+}
+
+#if (OS_PREEMPTIVE == STD_ON)
+/*********************************************************************************************/
+/* Description: Select the highest priority ready task (the idle loop if none is ready) and request
+ *              the context switch if it is not the running one, called with the interrupts masked
+ *              or from an interrupt */
+static void Os_Dispatch(void)
+{
+    uint8 Priority = 0;
+    uint32 Ready_Mask = g_Os_Ready_Mask;
+
+    if(Ready_Mask == 0U)
+    {
+        Priority = OS_IDLE_PRIORITY;
+    }
+    else
+    {
+        while((Ready_Mask & 1U) == 0U)
+        {
+            Ready_Mask >>= 1;
+            Priority++;
+        }
+    }
+
+    g_Os_Next_Tcb = &g_Os_Tcbs[Priority];
+    if(g_Os_Next_Tcb != g_Os_Current_Tcb)
+    {
+        NVIC_SYSTEM_INTCTRL = OS_PENDSV_SET_MASK;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+}
+
+/*********************************************************************************************/
+/* Description: Release the tasks in Frame_Priorities (bit n for the priority n), a release of a task
+ *              that did not finish its previous one is dropped, called from the tick interrupt.
+ *              A task still running an event release takes its frame release over without an overrun */
+static void Os_ActivateTasks(uint32 Frame_Priorities)
+{
+    uint8 Priority;
+    uint32 Missed_Priorities = g_Os_Ready_Mask & ~g_Os_Event_Ready_Mask & Frame_Priorities;
+
+    if(Missed_Priorities != 0U)
+    {
+        g_Os_Overload_Stats.Overruns++;
+        for(Priority = 0; Missed_Priorities != 0U; Priority++, Missed_Priorities >>= 1)
+        {
+            if((Missed_Priorities & 1U) != 0U)
+            {
+                g_Os_Overload_Stats.Missed_Activations[g_Os_Tcbs[Priority].Task]++;
+            }
+        }
+    }
+
+    g_Os_Event_Ready_Mask &= ~Frame_Priorities;
+    g_Os_Ready_Mask |= Frame_Priorities;
+    Os_Dispatch();
+}
+
+/*********************************************************************************************/
+/* Description: Body of the task of a priority, runs the task function once per release */
+static void Os_TaskEntry(uint32 Priority)
+{
+    void (*Task_Ptr)(void) = g_Os_Tasks[g_Os_Tcbs[Priority].Task].Task_Ptr;
+
+    while(1)
+    {
+        Task_Ptr();
+
+        /* The release is finished, the switch to the next ready task happens once the interrupts are enabled */
+        Disable_Exceptions();
+        g_Os_Ready_Mask &= ~((uint32)1 << Priority);
+        g_Os_Event_Ready_Mask &= ~((uint32)1 << Priority);
+        Os_Dispatch();
+        Enable_Exceptions();
+    }
+}
+
+/*********************************************************************************************/
+/* Description: Assign the rate monotonic priorities, release masks and initial stacks of the tasks */
+static void Os_BuildTasks(void)
+{
+    uint8 Priority;
+    uint8 Task;
+    uint8 Selected;
+    uint32 Assigned_Tasks = 0;
+    uint16 Frame;
+    uint32 *Sp;
+    uint8 Register;
+
+    for(Frame = 0; Frame < OS_FRAMES_NUMBER; Frame++)
+    {
+        g_Os_Frame_Priorities[Frame] = 0;
+    }
+
+    for(Priority = 0; Priority < OS_TASKS_NUMBER; Priority++)
+    {
+        /* The unassigned task with the shortest period, the first one in the table for equal periods */
+        Selected = OS_TASKS_NUMBER;
+        for(Task = 0; Task < OS_TASKS_NUMBER; Task++)
+        {
+            if(((Assigned_Tasks & ((uint32)1 << Task)) == 0U) &&
+               ((Selected == OS_TASKS_NUMBER) || (g_Os_Tasks[Task].Period < g_Os_Tasks[Selected].Period)))
+            {
+                Selected = Task;
+            }
+        }
+        Assigned_Tasks |= ((uint32)1 << Selected);
+        g_Os_Tcbs[Priority].Task = Selected;
+        g_Os_Task_Priority[Selected] = Priority;
+
+        for(Frame = 0; Frame < OS_FRAMES_NUMBER; Frame++)
+        {
+            if((g_Os_Frame_Tasks[Frame] & ((uint32)1 << Selected)) != 0U)
+            {
+                g_Os_Frame_Priorities[Frame] |= ((uint32)1 << Priority);
+            }
+        }
+
+        /* Initial frame as stacked by the hardware (R0 = Priority, PC = Os_TaskEntry) then by PendSV_Handler */
+        Sp = (uint32 *)&g_Os_Stacks[Priority][OS_STACK_UNITS];
+        *(--Sp) = OS_INITIAL_XPSR;                  /* xPSR */
+        *(--Sp) = ((uint32)Os_TaskEntry & 0xFFFFFFFEU); /* PC, the Thumb bit of the address cleared */
+        *(--Sp) = 0U;                               /* LR, Os_TaskEntry never returns */
+        *(--Sp) = 0U;                               /* R12 */
+        *(--Sp) = 0U;                               /* R3 */
+        *(--Sp) = 0U;                               /* R2 */
+        *(--Sp) = 0U;                               /* R1 */
+        *(--Sp) = Priority;                         /* R0 */
+        *(--Sp) = OS_EXC_RETURN_THREAD_PSP;         /* EXC_RETURN */
+        for(Register = 4; Register <= 11; Register++)
+        {
+            *(--Sp) = 0U;                           /* R11 to R4 */
+        }
+        g_Os_Tcbs[Priority].Sp = Sp;
+    }
+
+    /* The idle loop context is saved by the first switch, it runs on the last stack */
+    g_Os_Tcbs[OS_IDLE_PRIORITY].Task = OS_TASKS_NUMBER;
+    g_Os_Current_Tcb = &g_Os_Tcbs[OS_IDLE_PRIORITY];
+    g_Os_Next_Tcb    = &g_Os_Tcbs[OS_IDLE_PRIORITY];
+
+    /* PendSV has the lowest priority so the switch happens once all the interrupts are served */
+    NVIC_SYSTEM_PRI3_REG = (NVIC_SYSTEM_PRI3_REG & OS_PENDSV_PRIORITY_MASK) | (OS_PENDSV_INTERRUPT_PRIORITY << OS_PENDSV_PRIORITY_BITS_POS);
+}
+#endif
+
+#if (OS_IDLE_SLEEP == STD_ON)
+/*********************************************************************************************/
+/* Description: Sleep until the next interrupt if no tick (no ready task in the preemptive mode) is pending
+ *              and account the idle time */
+static void Os_Idle(void)
+{
+    uint32 Start_Count;
+    uint32 End_Count;
+
+    /*
+     * The idle condition is checked with the interrupts masked so a tick cannot be lost between
+     * the check and WFI, WFI still wakes up on the pending interrupt which runs once unmasked.
+     */
+    Disable_Exceptions();
+    if(OS_IDLE_CONDITION())
+    {
+        (void)SysTick_GetCountFlag(); /* Clear the COUNTFLAG before sleeping */
+        Start_Count = SysTick_GetCounter();
+
+        Wait_For_Interrupt();
+
+        End_Count = SysTick_GetCounter();
+        if(SysTick_GetCountFlag() == TRUE)
+        {
+            /* Woken up by the end of the SysTick period, the sleep lasted until the counter reached 0 */
+            g_Os_Idle_Stats.Idle_Cycles += Start_Count;
+        }
+        else
+        {
+            /* Woken up by another interrupt in the same period */
+            g_Os_Idle_Stats.Idle_Cycles += (Start_Count - End_Count);
+        }
+        g_Os_Idle_Stats.Wakeups++;
+    }
+    Enable_Exceptions();
+}
+#endif
+
+#if (OS_TASK_PROFILING == STD_ON)
+/*********************************************************************************************/
+/* Description: Run a task and update its statistics from the SysTick down counter:
+ *              the start latency is the time from the tick to the task entry and the
+ *              execution time is the time from the task entry to its exit */
+static void Os_RunTaskProfiled(uint8 Task)
+{
+    uint32 Start_Count;
+    uint32 End_Count;
+    uint32 Period_Cycles = g_Period_Cycles;
+#if (OS_TICKLESS == STD_ON)
+    /* The counter reloads with the period programmed at the last tick, which follows the running one */
+    uint32 Next_Period_Cycles = g_Frame_Cycles * g_Os_Frame_Skip[g_Next_Frame_Index];
+#else
+    uint32 Next_Period_Cycles = Period_Cycles;
+#endif
+    uint32 Latency;
+    uint32 Exec_Time;
+    Os_TaskStatsType *Stats_Ptr = &g_Os_Task_Stats[Task];
+
+    Start_Count = SysTick_GetCounter();
+    g_Os_Tasks[Task].Task_Ptr();
+    End_Count = SysTick_GetCounter();
+
+    /* SysTick counts down from Period_Cycles - 1 to 0 */
+    Latency = (Period_Cycles - 1U) - Start_Count;
+    if(Start_Count >= End_Count)
+    {
+        Exec_Time = Start_Count - End_Count;
+    }
+    else
+    {
+        /* The counter reloaded while the task was running, the tick may already have changed g_Period_Cycles */
+        Exec_Time = Start_Count + (Next_Period_Cycles - End_Count);
+    }
+
+    if((Stats_Ptr->Runs == 0U) || (Exec_Time < Stats_Ptr->Exec_Min))
+    {
+        Stats_Ptr->Exec_Min = Exec_Time;
+    }
+    if(Exec_Time > Stats_Ptr->Exec_Max)
+    {
+        Stats_Ptr->Exec_Max = Exec_Time;
+    }
+    if((Stats_Ptr->Runs == 0U) || (Latency < Stats_Ptr->Start_Min))
+    {
+        Stats_Ptr->Start_Min = Latency;
+    }
+    if(Latency > Stats_Ptr->Start_Max)
+    {
+        Stats_Ptr->Start_Max = Latency;
+    }
+    Stats_Ptr->Runs++;
+    g_Os_Task_Exec_Total[Task] += Exec_Time;
+    g_Os_Busy_Cycles += Exec_Time;
+}
+#endif
 
 /*********************************************************************************************/
 void Os_start(void)
 {
+#if (OS_PREEMPTIVE == STD_ON)
+    /*
+     * The interrupts stay masked until the idle loop runs on its stack, an interrupt releasing
+     * a task (tick or Os_ActivateTask) before would switch out of the main stack
+     */
+    Disable_Exceptions();
+#else
     /* Global Interrupts Enable */
     Enable_Exceptions();
+#endif
+
+    /* Execute the Init Task first, the SysTick reload depends on the core clock set by Mcu_Init */
+    Init_Task();
+
+    /* Generate the minor frames of the major frame from the task table */
+    Os_BuildSchedule();
+#if (OS_PREEMPTIVE == STD_ON)
+    /* Assign the task priorities and stacks */
+    Os_BuildTasks();
+#endif
     
     /* 
      * Set the Call Back function to call Os_NewTimerTick
@@ -45,62 +631,305 @@ void Os_start(void)
      */
     SysTick_SetCallBack(Os_NewTimerTick);
 
+#if (OS_TICKLESS == STD_ON)
+    /* Start SysTickTimer to expire at the first frame with tasks then program the period that follows it */
+    g_Next_Frame_Index = g_Os_Frame_Skip[0] % OS_FRAMES_NUMBER;
+    SysTick_Start((uint32)g_Os_Frame_Skip[0] * OS_BASE_TIME);
+    SysTick_SetNextPeriod((uint32)g_Os_Frame_Skip[g_Next_Frame_Index] * OS_BASE_TIME);
+#else
     /* Start SysTickTimer to generate interrupt every 20ms */
     SysTick_Start(OS_BASE_TIME);
+#endif
 
-    /* Execute the Init Task */
-    Init_Task();
-
+#if (OS_PREEMPTIVE == STD_ON)
+    /* Start the idle loop on its stack, the tasks are switched in by PendSV at their release */
+    Os_StartIdle((uint32 *)&g_Os_Stacks[OS_IDLE_PRIORITY][OS_STACK_UNITS], Os_Scheduler);
+#else
     /* Start the Os Scheduler */
     Os_Scheduler();
+#endif
 }
 
 /*********************************************************************************************/
 void Os_NewTimerTick(void)
 {
-    /* Increment the Os time by OS_BASE_TIME */
-    g_Time_Tick_Count   += OS_BASE_TIME;
+    g_Os_Idle_Stats.Ticks++;
+    g_Os_Idle_Stats.Elapsed_Cycles += g_Period_Cycles;
+
+    /* A tick while the tasks of a frame are still running is an overrun */
+    if(g_Frame_Running_Flag == 1)
+    {
+        g_Os_Overload_Stats.Overruns++;
+        g_Overrun_Flag = 1;
+    }
+
+#if (OS_TICKLESS == STD_ON)
+    /* The period that just ended covered the frames from the previous frame to the reached one */
+    g_Frame_Counter += g_Os_Frame_Skip[g_Frame_Index];
+
+    /* The running period covers the frames from the reached one to the next one with tasks */
+    g_Frame_Index = g_Next_Frame_Index;
+    g_Period_Cycles = g_Frame_Cycles * g_Os_Frame_Skip[g_Frame_Index];
 
+    /*
+     * SysTick already reloaded the period programmed at the previous tick, which ends at the
+     * next frame with tasks, program the period that follows it.
+     */
+    g_Next_Frame_Index = (g_Frame_Index + g_Os_Frame_Skip[g_Frame_Index]) % OS_FRAMES_NUMBER;
+    SysTick_SetNextPeriod((uint32)g_Os_Frame_Skip[g_Next_Frame_Index] * OS_BASE_TIME);
+#else
+    g_Frame_Counter++;
+
+    /* Move to the next minor frame, the major frame restarts after OS_HYPERPERIOD */
+    if(g_Frame_Index >= (OS_FRAMES_NUMBER - 1))
+    {
+        g_Frame_Index = 0;
+    }
+    else
+    {
+        g_Frame_Index++;
+    }
+#endif
+
+#if (OS_PREEMPTIVE == STD_ON)
+    /* Release the tasks of the reached frame, they preempt any lower priority task */
+    Os_ActivateTasks(g_Os_Frame_Priorities[g_Frame_Index]);
+#else
     /* Set the flag to 1 to indicate that there is a new timer tick */
     g_New_Time_Tick_Flag = 1;
+#endif
 }
 
+#if (OS_PREEMPTIVE == STD_OFF)
+/*********************************************************************************************/
+/* Description: Run the tasks in Frame_Tasks (bit n for the task n of the table) in the order of the table */
+static void Os_RunTasks(uint32 Frame_Tasks)
+{
+    uint8 Task;
+
+    for(Task = 0; Frame_Tasks != 0; Task++, Frame_Tasks >>= 1)
+    {
+        if((Frame_Tasks & 1U) != 0)
+        {
+#if (OS_TASK_PROFILING == STD_ON)
+            Os_RunTaskProfiled(Task);
+#else
+            g_Os_Tasks[Task].Task_Ptr();
+#endif
+        }
+    }
+}
+
+/*********************************************************************************************/
+/* Description: Run the tasks released by Os_ActivateTask in Event_Tasks in the order of the table, they are
+ *              not profiled as their start is not related to the tick and they are not part of a frame */
+static void Os_RunEventTasks(uint32 Event_Tasks)
+{
+    uint8 Task;
+
+    for(Task = 0; Event_Tasks != 0; Task++, Event_Tasks >>= 1)
+    {
+        if((Event_Tasks & 1U) != 0)
+        {
+            g_Os_Tasks[Task].Task_Ptr();
+        }
+    }
+}
+
+/*********************************************************************************************/
+/* Description: Count the releases of the tasks in Frame_Tasks dropped by the overload policy */
+static void Os_MissTasks(uint32 Frame_Tasks)
+{
+    uint8 Task;
+
+    for(Task = 0; Frame_Tasks != 0; Task++, Frame_Tasks >>= 1)
+    {
+        if((Frame_Tasks & 1U) != 0)
+        {
+            g_Os_Overload_Stats.Missed_Activations[Task]++;
+        }
+    }
+}
+
+/*********************************************************************************************/
+/* Description: Handle all the frames reached since the last dispatch, the frames before the
+ *              latest one are late and handled by the overload policy */
+static void Os_DispatchFrames(uint32 Reached_Frame)
+{
+    uint32 Frame;
+    uint32 Frame_Tasks;
+    uint32 Run_Tasks;
+#if (OS_OVERLOAD_POLICY == OS_OVERLOAD_DEGRADE)
+    boolean Overloaded = (g_Overrun_Flag == 1) ? TRUE : FALSE; /* The previous frame overran */
+#endif
+
+    g_Frame_Running_Flag = 1;
+    g_Overrun_Flag = 0;
+
+    for(Frame = g_Dispatched_Frame_Counter + 1; Frame != (Reached_Frame + 1); Frame++)
+    {
+        Frame_Tasks = g_Os_Frame_Tasks[Frame % OS_FRAMES_NUMBER];
+        if(Frame_Tasks == 0)
+        {
+            /* Empty frame, nothing is late */
+            continue;
+        }
+
+        if(Frame != Reached_Frame)
+        {
+            /* Late frame: its tick came while the scheduler was busy */
+            g_Os_Overload_Stats.Late_Frames++;
+#if (OS_OVERLOAD_POLICY == OS_OVERLOAD_CATCH_UP)
+            Run_Tasks = ((Reached_Frame - Frame) <= OS_MAX_CATCH_UP_FRAMES) ? Frame_Tasks : 0;
+#elif (OS_OVERLOAD_POLICY == OS_OVERLOAD_DEGRADE)
+            Overloaded = TRUE;
+            Run_Tasks = Frame_Tasks & g_Os_Critical_Tasks;
+#else
+            Run_Tasks = 0;
+#endif
+        }
+        else
+        {
+            /* Latest frame */
+#if (OS_OVERLOAD_POLICY == OS_OVERLOAD_DEGRADE)
+            Run_Tasks = (Overloaded == TRUE) ? (Frame_Tasks & g_Os_Critical_Tasks) : Frame_Tasks;
+#else
+            Run_Tasks = Frame_Tasks;
+#endif
+        }
+
+        Os_MissTasks(Frame_Tasks & ~Run_Tasks);
+        Os_RunTasks(Run_Tasks);
+    }
+
+    g_Dispatched_Frame_Counter = Reached_Frame;
+    g_Frame_Running_Flag = 0;
+}
+#endif
+
 /*********************************************************************************************/
 void Os_Scheduler(void)
 {
+#if (OS_PREEMPTIVE == STD_ON)
+    /* Idle loop, preempted by the tasks at their release */
     while(1)
     {
-	/* Code is only executed in case there is a new timer tick */
-	if(g_New_Time_Tick_Flag == 1)
-	{
-	    switch(g_Time_Tick_Count)
-            {
-		case 20:
-		case 100:
-			    Button_Task();
-			    g_New_Time_Tick_Flag = 0;
-			    break;
-		case 40:
-		case 80:
-			    Button_Task();
-			    Led_Task();
-			    g_New_Time_Tick_Flag = 0;
-			    break;
-		case 60:
-			    Button_Task();
-			    App_Task();
-			    g_New_Time_Tick_Flag = 0;
-			    break;
-		case 120:
-			    Button_Task();
-			    App_Task();
-			    Led_Task();
-			    g_New_Time_Tick_Flag = 0;
-			    g_Time_Tick_Count = 0;
-			    break;
-            }
-	}
+#if (OS_IDLE_SLEEP == STD_ON)
+        Os_Idle();
+#endif
+    }
+#else
+    uint32 Event_Tasks;
+
+    while(1)
+    {
+#if (OS_IDLE_SLEEP == STD_ON)
+        Os_Idle();
+#endif
+        /* Tasks released by an event run first, in the order of the table */
+        if(g_Os_Event_Tasks != 0U)
+        {
+            Disable_Exceptions();
+            Event_Tasks = g_Os_Event_Tasks;
+            g_Os_Event_Tasks = 0;
+            Enable_Exceptions();
+
+            Os_RunEventTasks(Event_Tasks);
+        }
+
+        /* Code is only executed in case there is a new timer tick */
+        if(g_New_Time_Tick_Flag == 1)
+        {
+            g_New_Time_Tick_Flag = 0;
+
+            /*
+             * Every frame reached since the last dispatch is handled, so ticks that came while the
+             * tasks were running are never silently merged into one frame.
+             */
+            Os_DispatchFrames(g_Frame_Counter);
+        }
+    }
+#endif
+}
+
+/*********************************************************************************************/
+void Os_ActivateTask(Os_TaskIdType Task_Id)
+{
+    if(Task_Id < OS_TASKS_NUMBER)
+    {
+        Disable_Exceptions(); /* The releases are also updated by the tick interrupt */
+#if (OS_PREEMPTIVE == STD_ON)
+        /* The task preempts the running one if its priority is higher, a task already released keeps its release */
+        if((g_Os_Ready_Mask & ((uint32)1 << g_Os_Task_Priority[Task_Id])) == 0U)
+        {
+            g_Os_Event_Ready_Mask |= ((uint32)1 << g_Os_Task_Priority[Task_Id]);
+            g_Os_Ready_Mask |= ((uint32)1 << g_Os_Task_Priority[Task_Id]);
+        }
+        Os_Dispatch();
+#else
+        /* The scheduler loop runs the task once the running task returns */
+        g_Os_Event_Tasks |= ((uint32)1 << Task_Id);
+#endif
+        Enable_Exceptions();
     }
+}
+
+/*********************************************************************************************/
+void Os_GetIdleStats(Os_IdleStatsType *Stats_Ptr)
+{
+    if(Stats_Ptr != NULL_PTR)
+    {
+        Disable_Exceptions(); /* The statistics are updated by the tick interrupt */
+        *Stats_Ptr = g_Os_Idle_Stats;
+        Enable_Exceptions();
+    }
+}
+
+#if (OS_TASK_PROFILING == STD_ON)
+/*********************************************************************************************/
+Std_ReturnType Os_GetTaskStats(Os_TaskIdType Task_Id, Os_TaskStatsType *Stats_Ptr)
+{
+    Std_ReturnType Status = E_NOT_OK;
+
+    if((Stats_Ptr != NULL_PTR) && (Task_Id < OS_TASKS_NUMBER))
+    {
+        *Stats_Ptr = g_Os_Task_Stats[Task_Id];
+        Stats_Ptr->Exec_Mean = (Stats_Ptr->Runs != 0U) ? (uint32)(g_Os_Task_Exec_Total[Task_Id] / Stats_Ptr->Runs) : 0U;
+        Status = E_OK;
+    }
+    return Status;
+}
 
+/*********************************************************************************************/
+uint8 Os_GetCpuLoad(void)
+{
+    uint64 Elapsed_Cycles;
+
+    Disable_Exceptions(); /* The elapsed time is updated by the tick interrupt */
+    Elapsed_Cycles = g_Os_Idle_Stats.Elapsed_Cycles;
+    Enable_Exceptions();
+
+    return (Elapsed_Cycles != 0U) ? (uint8)((g_Os_Busy_Cycles * 100U) / Elapsed_Cycles) : 0U;
+}
+#endif
+
+/*********************************************************************************************/
+void Os_GetOverloadStats(Os_OverloadStatsType *Stats_Ptr)
+{
+    if(Stats_Ptr != NULL_PTR)
+    {
+        Disable_Exceptions(); /* The overruns are updated by the tick interrupt */
+        *Stats_Ptr = g_Os_Overload_Stats;
+        Enable_Exceptions();
+    }
+}
+
+/*********************************************************************************************/
+void Os_GetScheduleInfo(Os_ScheduleInfoType *Info_Ptr)
+{
+    if(Info_Ptr != NULL_PTR)
+    {
+        *Info_Ptr = g_Os_Schedule_Info;
+    }
 }
 /*********************************************************************************************/
@@ -13,23 +13,103 @@
 #define OS_H_
 
 #include "Std_Types.h"
+#include "Os_Cfg.h"
 
-/* Timer counting time in ms */
-#define OS_BASE_TIME 20
+/* Description: Configuration of one task of the static task table */
+typedef struct
+{
+    void (*Task_Ptr)(void); /* Task function */
+    uint16 Period;          /* Period in ms */
+    uint16 Offset;          /* Offset in ms from the start of the major frame */
+    uint16 Budget;          /* Execution time budget in us */
+    uint8  Critical;        /* STD_ON if the task keeps running under overload */
+} Os_TaskConfigType;
+
+/* Description: Schedule generated from the task table by Os_start */
+typedef struct
+{
+    uint16 Frames_Number;        /* Number of minor frames in the major frame */
+    uint8  Max_Tasks_Per_Frame;  /* Maximum number of tasks released in one minor frame */
+    uint32 Worst_Frame_Budget;   /* Worst case sum of the task budgets in one minor frame in us */
+    uint8  Worst_Frame_Load;     /* Worst case load of one minor frame in percent of OS_BASE_TIME */
+    uint16 Utilization;          /* CPU utilization of the task budgets in per mille */
+    boolean Rm_Schedulable;      /* TRUE if the utilization is below the rate monotonic bound n(2^(1/n) - 1) */
+} Os_ScheduleInfoType;
+
+/* Description: Idle statistics of the scheduler, times in core clock cycles */
+typedef struct
+{
+    uint32 Ticks;          /* Number of Os timer interrupts */
+    uint32 Wakeups;        /* Number of times the CPU left the idle sleep */
+    uint64 Elapsed_Cycles; /* Time elapsed since the Os timer started */
+    uint64 Idle_Cycles;    /* Time spent sleeping in the idle loop */
+} Os_IdleStatsType;
+
+/* Description: Id of each task of the table (OS_TASK_ID_<Function>), in the order of the table,
+ *              OS_TASK_ID_INVALID is also the number of the tasks */
+#define OS_TASK_ID_ENTRY(FUNC, PERIOD, OFFSET, BUDGET, CRITICAL)   OS_TASK_ID_##FUNC,
+typedef enum
+{
+    OS_TASKS_LIST(OS_TASK_ID_ENTRY)
+    OS_TASK_ID_INVALID
+} Os_TaskIdType;
+
+/* Description: Overload statistics of the scheduler */
+typedef struct
+{
+    uint32 Overruns;                               /* Ticks that came while a frame (or a task in the preemptive mode) was still running */
+    uint32 Late_Frames;                            /* Frames with tasks that were not dispatched at their tick */
+    uint32 Missed_Activations[OS_TASK_ID_INVALID]; /* Releases of each task dropped by the overload policy */
+} Os_OverloadStatsType;
+
+/* Description: Profiling statistics of one task, times in core clock cycles */
+typedef struct
+{
+    uint32 Runs;       /* Number of runs of the task */
+    uint32 Exec_Min;   /* Minimum execution time */
+    uint32 Exec_Max;   /* Maximum execution time */
+    uint32 Exec_Mean;  /* Mean execution time */
+    uint32 Start_Min;  /* Minimum time from the tick to the task start */
+    uint32 Start_Max;  /* Maximum time from the tick to the task start, Start_Max - Start_Min is the release jitter */
+} Os_TaskStatsType;
 
 /* Description: 
  * Function responsible for:
  * 1. Enable Interrupts
- * 2. Start the Os timer
- * 3. Execute the Init Task
- * 4. Start the Scheduler to run the tasks
+ * 2. Execute the Init Task
+ * 3. Generate the schedule from the task table
+ * 4. Start the Os timer
+ * 5. Start the Scheduler to run the tasks
  */
 void Os_start(void);
 
-/* Description: The Engine of the Os Scheduler used for switch between different tasks */
+/* Description: The Engine of the Os Scheduler used for switch between different tasks,
+ *              in the preemptive mode it is the idle loop running when no task is ready */
 void Os_Scheduler(void);
 
 /* Description: Function called by the Timer Driver in the MCAL layer using the call back pointer */
 void Os_NewTimerTick(void);
 
+/* Description: Function to release a task on an event (e.g. from a GPIO interrupt notification) without waiting
+ *              for its frame, a release of a task that is already released and not finished is merged with it */
+void Os_ActivateTask(Os_TaskIdType Task_Id);
+
+/* Description: Function to get the frames number and the worst case frame load of the generated schedule */
+void Os_GetScheduleInfo(Os_ScheduleInfoType *Info_Ptr);
+
+/* Description: Function to get the number of ticks and wakeups and the idle time since the Os timer started */
+void Os_GetIdleStats(Os_IdleStatsType *Stats_Ptr);
+
+/* Description: Function to get the overruns, late frames and missed activations of each task */
+void Os_GetOverloadStats(Os_OverloadStatsType *Stats_Ptr);
+
+#if (OS_TASK_PROFILING == STD_ON)
+/* Description: Function to get the execution time and start latency statistics of a task,
+ *              returns E_NOT_OK if the Task_Id is invalid */
+Std_ReturnType Os_GetTaskStats(Os_TaskIdType Task_Id, Os_TaskStatsType *Stats_Ptr);
+
+/* Description: Function to get the CPU load of the tasks in percent of the elapsed time */
+uint8 Os_GetCpuLoad(void);
+#endif
+
 #endif /* OS_H_ */
@@ -0,0 +1,102 @@
+/******************************************************************************
+ *
+ * Module: Os
+ *
+ * File Name: Os_Cfg.h
+ *
+ * Description: Header file for Pre-Compiler configuration used by Os Scheduler
+ *
+ * Author: Tarek Emad
+ ******************************************************************************/
+
+#ifndef OS_CFG_H_
+#define OS_CFG_H_
+
+/* Timer counting time in ms (duration of one minor frame) */
+#define OS_BASE_TIME 20
+
+/* Duration of the major frame in ms, must be a multiple of OS_BASE_TIME and of every task period */
+#define OS_HYPERPERIOD 120
+
+/*
+ * Pre-compile option for the idle loop of the scheduler:
+ * STD_ON  --> the CPU sleeps with WFI until the next interrupt when no task is ready
+ * STD_OFF --> the scheduler polls the tick flag
+ */
+#define OS_IDLE_SLEEP    (STD_ON)
+
+/*
+ * Pre-compile option for tickless operation:
+ * STD_ON  --> SysTick is reprogrammed to expire at the next minor frame that releases a task,
+ *             empty frames do not wake the CPU up
+ * STD_OFF --> SysTick expires every OS_BASE_TIME
+ */
+#ifndef OS_TICKLESS
+#define OS_TICKLESS      (STD_OFF)
+#endif
+
+/*
+ * Pre-compile option for the task profiler (Os_GetTaskStats/Os_GetCpuLoad):
+ * STD_ON  --> each task run is timestamped with the SysTick counter at its entry and exit
+ * STD_OFF --> the tasks are called directly without any overhead
+ */
+#ifndef OS_TASK_PROFILING
+#define OS_TASK_PROFILING (STD_OFF)
+#endif
+
+/*
+ * Pre-compile option for the scheduling mode:
+ * STD_ON  --> preemptive fixed priority kernel, each task has its own stack and runs at a rate
+ *             monotonic priority (the shorter the period the higher the priority, ties in the
+ *             order of the table), the context switch is done by the PendSV exception
+ * STD_OFF --> cooperative cyclic executive, the tasks of a frame run to completion one after the other
+ */
+#ifndef OS_PREEMPTIVE
+#define OS_PREEMPTIVE     (STD_OFF)
+#endif
+
+/* Stack size in bytes of each task and of the idle loop in the preemptive mode, multiple of 8 */
+#define OS_TASK_STACK_SIZE (512U)
+
+/*
+ * Policy of the cooperative mode for the frames whose tick came while the scheduler was still running a frame,
+ * in the preemptive mode a release of a task that did not finish its previous one is dropped:
+ * OS_OVERLOAD_SKIP     : the late frames are dropped, only the latest frame runs
+ * OS_OVERLOAD_CATCH_UP : the late frames run back to back, up to OS_MAX_CATCH_UP_FRAMES behind the latest one
+ * OS_OVERLOAD_DEGRADE  : only the critical tasks of the late frames and of the latest frame run
+ */
+#define OS_OVERLOAD_SKIP       (0U)
+#define OS_OVERLOAD_CATCH_UP   (1U)
+#define OS_OVERLOAD_DEGRADE    (2U)
+
+#ifndef OS_OVERLOAD_POLICY
+#define OS_OVERLOAD_POLICY     (OS_OVERLOAD_SKIP)
+#endif
+
+/* Maximum number of frames a late frame may be behind the latest one to still run (OS_OVERLOAD_CATCH_UP) */
+#ifndef OS_MAX_CATCH_UP_FRAMES
+#define OS_MAX_CATCH_UP_FRAMES (2U)
+#endif
+
+/*
+ * Static task table, each entry is:
+ * OS_TASK(Function, Period in ms, Offset in ms, Execution time budget in us, Critical)
+ * A task runs in every minor frame that starts at Offset + n * Period from the start of
+ * the major frame, tasks due in the same frame run in the order of this table.
+ * Critical tasks (STD_ON) keep running when the OS_OVERLOAD_DEGRADE policy drops the others.
+ * A build can provide its own table to run the kernel with other task sets.
+ * Button_Task is also released by every SW1 edge and App_Task by every change of the button state
+ * (App.c), so App_Task runs every 60 ms plus once per press or release, these event releases are
+ * not profiled and are never counted as overruns.
+ * SW1 is debounced by Button_Task alone, Button_RefreshPorts is not scheduled until an application
+ * consumes its port edges.
+ */
+#ifndef OS_TASKS_LIST
+#define OS_TASKS_LIST(OS_TASK) \
+    OS_TASK(Button_Task, 20, 0, 50, STD_ON)  \
+    OS_TASK(App_Task,    60, 0, 50, STD_ON)  \
+    OS_TASK(Led_Task,    40, 0, 50, STD_OFF)
+#endif
+
+
+#endif /* OS_CFG_H_ */
@@ -39,232 +39,388 @@ static uint8 Port_Status = PORT_NOT_INITIALIZED;
 /*pointer to the configuration structure*/
 STATIC const Port_ConfigType *Port_Configurs = NULL_PTR;
 
-/************************************************************************************
- * Service Name: Port_SetupGpioPin
- * Sync/Async: Synchronous
- * service ID[hex]: 0x00
- * Reentrancy: reentrant
- * Parameters (in): ConfigPtr - Pointer to post-build configuration data
- * Parameters (inout): None
- * Parameters (out): None
- * Return value: None
- * Description: Function to Setup the pin configuration:
- *              - Setup the pin as Digital GPIO pin
- *              - Setup the direction of the GPIO pin
- *              - Provide initial value for o/p pin
- *              - Setup the internal resistor for i/p pin
- ************************************************************************************/
-/**
- * @brief Function to Setup the GPIO pin configuration.
- *
- * This function initializes and configures a GPIO pin as per the provided
- * configuration. It sets up the pin as a Digital GPIO pin, determines the
- * pin direction (input/output), assigns an initial value for the output pin,
- * and configures internal resistors for input pins.
- *
- * @param[in] ConfigPtr Pointer to post-build configuration data.
- * 
- * @details 
- * The function performs the following operations:
- * - Checks for a valid configuration pointer.
- * - Iterates through all configured pins and sets their properties:
- *   - Enables the clock for the required port.
- *   - Sets the pin as a digital GPIO or analog pin.
- *   - Configures the pin's direction and internal resistor type.
- *   - Provides an initial output value for the pin.
- *
- * Reentrancy: Reentrant
- * 
- * Sync/Async: Synchronous
- * 
- * Service ID: 0x00
- * 
- * Errors:
- * - Reports an error if the configuration pointer is NULL.
- * 
- * @return None
- * 
- * 
- */
-///@code
-void Port_Init(const Port_ConfigType *ConfigPtr)
+#if (PORT_SET_PIN_DIRECTION_API == STD_ON)
+/* Pins corrected by the last Port_RefreshPortDirection call */
+STATIC Port_DirectionDriftType Port_DirectionDrift;
+#endif
+
+#if (PORT_INIT_INSTRUMENTATION == STD_ON)
+/* Register access statistics of the last Port_Init call */
+STATIC Port_InitStatsType Port_InitStats;
+
+/* Record the register accesses done by Port_Init */
+#define PORT_STATS_READ(REG)     (Port_InitStats.ReadCount[(REG)]++)
+#define PORT_STATS_WRITE(REG)    (Port_InitStats.WriteCount[(REG)]++)
+#define PORT_STATS_RMW(REG)      (PORT_STATS_READ(REG), PORT_STATS_WRITE(REG))
+
+/* Clear all the counters before a new Port_Init call */
+STATIC void Port_ResetInitStats(void)
 {
+    uint8 Reg;
 
-#if (PORT_DEV_ERROR_DETECT == STD_ON)
-    /* Check if the input configuration pointer is not a NULL_PTR */
-    if (ConfigPtr == NULL_PTR)
+    for (Reg = 0; Reg < PORT_STATS_REGS_NUMBER; Reg++)
     {
-        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_INIT_SID, PORT_E_PARAM_CONFIG);
+        Port_InitStats.ReadCount[Reg] = 0;
+        Port_InitStats.WriteCount[Reg] = 0;
     }
-    else
+    Port_InitStats.EstimatedBusCycles = 0;
+}
+
+/* Estimate the bus cycles spent on register accesses from the recorded counters */
+STATIC uint32 Port_EstimateBusCycles(void)
+{
+    uint8 Reg;
+    uint32 Cycles = 0;
+
+    for (Reg = 0; Reg < PORT_STATS_REGS_NUMBER; Reg++)
     {
-        /* No action required */
+        Cycles += (uint32)Port_InitStats.ReadCount[Reg] * PORT_REG_READ_BUS_CYCLES;
+        Cycles += (uint32)Port_InitStats.WriteCount[Reg] * PORT_REG_WRITE_BUS_CYCLES;
     }
+    return Cycles;
+}
+#else
+#define PORT_STATS_READ(REG)     ((void)0)
+#define PORT_STATS_WRITE(REG)    ((void)0)
+#define PORT_STATS_RMW(REG)      ((void)0)
 #endif
-    Port_Status = PORT_INITIALIZED;
-    Port_Configurs = ConfigPtr;
-    uint8 Channel=0;
-    boolean error = FALSE;
 
+/* Base address of each GPIO port indexed by the port number (0 --> PORTA .. 5 --> PORTF) */
+STATIC const uint32 Port_BaseAddress[PORT_NUMBER_OF_PORTS] = {
+    PORT_SELECT_BASE_ADDRESS(0, GPIO_PORTA_BASE_ADDRESS, GPIO_PORTA_AHB_BASE_ADDRESS),
+    PORT_SELECT_BASE_ADDRESS(1, GPIO_PORTB_BASE_ADDRESS, GPIO_PORTB_AHB_BASE_ADDRESS),
+    PORT_SELECT_BASE_ADDRESS(2, GPIO_PORTC_BASE_ADDRESS, GPIO_PORTC_AHB_BASE_ADDRESS),
+    PORT_SELECT_BASE_ADDRESS(3, GPIO_PORTD_BASE_ADDRESS, GPIO_PORTD_AHB_BASE_ADDRESS),
+    PORT_SELECT_BASE_ADDRESS(4, GPIO_PORTE_BASE_ADDRESS, GPIO_PORTE_AHB_BASE_ADDRESS),
+    PORT_SELECT_BASE_ADDRESS(5, GPIO_PORTF_BASE_ADDRESS, GPIO_PORTF_AHB_BASE_ADDRESS)
+};
+
+#if (PORT_PIN_EDGE_NOTIFICATION_API == STD_ON)
+/* Notification of each pin of each port called by the GPIO interrupt of the port, NULL_PTR if none */
+STATIC Port_PinNotificationType Port_PinNotifications[PORT_NUMBER_OF_PORTS][8];
+#endif
+
+#if (PORT_PRECOMPUTED_REGISTER_IMAGES == STD_OFF)
+/* Register values of each port aggregated from the pins configuration by Port_Init */
+STATIC Port_RegisterImageType Port_RegisterImages[PORT_NUMBER_OF_PORTS];
+#endif
+
+/* Register images of each port written by Port_Init (precomputed in flash or built in RAM) */
+STATIC const Port_RegisterImageType *Port_Images = NULL_PTR;
+
+/* Access the register at OFFSET of the port whose registers start at PortGpio_Ptr */
+#define PORT_REG(PORTGPIO_PTR, OFFSET)  (*(volatile uint32 *)((volatile uint8 *)(PORTGPIO_PTR) + (OFFSET)))
+
+#if (PORT_PRECOMPUTED_REGISTER_IMAGES == STD_OFF)
+/************************************************************************************
+ * Service Name: Port_BuildRegisterImages
+ * Description: Aggregate the pins configuration into the per port register images:
+ *              for each port the pins it configures and the value of every register
+ *              (DIR, DEN, AFSEL, AMSEL, PUR, PDR, DATA, PCTL) on these pins.
+ *              JTAG pins (PC0 .. PC3) are never part of an image.
+ ************************************************************************************/
+STATIC void Port_BuildRegisterImages(const Port_ConfigType *ConfigPtr)
+{
+    uint8 Port;
+    uint8 Channel;
 
+    for (Port = 0; Port < PORT_NUMBER_OF_PORTS; Port++)
+    {
+        Port_RegisterImages[Port].pins_mask = 0;
+        Port_RegisterImages[Port].commit_mask = 0;
+        Port_RegisterImages[Port].dir = 0;
+        Port_RegisterImages[Port].den = 0;
+        Port_RegisterImages[Port].afsel = 0;
+        Port_RegisterImages[Port].amsel = 0;
+        Port_RegisterImages[Port].pur = 0;
+        Port_RegisterImages[Port].pdr = 0;
+        Port_RegisterImages[Port].data = 0;
+        Port_RegisterImages[Port].pctl_mask = 0;
+        Port_RegisterImages[Port].pctl = 0;
+        Port_RegisterImages[Port].refresh_mask = 0;
+    }
 
-    while (Channel<PORT_CONFIGURED_PINS)
+    for (Channel = 0; Channel < PORT_CONFIGURED_PINS; Channel++)
     {
-        /* Check if the pin is configured as changeable */
+        Port_ConfigChannel Pin_Config = ConfigPtr->Channels[Channel];
+        Port_RegisterImageType *Image_Ptr = &Port_RegisterImages[PORT_CHANNEL_PORT_NUM(Pin_Config)];
+        uint32 Pin_Mask = ((uint32)1 << PORT_CHANNEL_PIN_NUM(Pin_Config));
 
-        volatile uint32 *PortGpio_Ptr = NULL_PTR; /* point to the required Port Registers base address */
-        switch (ConfigPtr->Channels[Channel].port_num)
+        if (PORT_IS_JTAG_PIN(PORT_CHANNEL_PORT_NUM(Pin_Config), PORT_CHANNEL_PIN_NUM(Pin_Config)))
         {
-        case 0:
-            PortGpio_Ptr = (volatile uint32 *)GPIO_PORTA_BASE_ADDRESS;
-            break;
-        case 1:
-            PortGpio_Ptr = (volatile uint32 *)GPIO_PORTB_BASE_ADDRESS;
-            break;
-        case 2:
-            PortGpio_Ptr = (volatile uint32 *)GPIO_PORTC_BASE_ADDRESS;
-            break;
-        case 3:
-            PortGpio_Ptr = (volatile uint32 *)GPIO_PORTD_BASE_ADDRESS;
-            break;
-        case 4:
-            PortGpio_Ptr = (volatile uint32 *)GPIO_PORTE_BASE_ADDRESS;
-            break;
-        case 5:
-            PortGpio_Ptr = (volatile uint32 *)GPIO_PORTF_BASE_ADDRESS;
-            break;
-        default:
-            break;
+            /* Do Nothing
+             * This is jtag pins */
+            continue;
         }
-
-        if (TRUE == error)
+        else if (PORT_IS_LOCKED_PIN(PORT_CHANNEL_PORT_NUM(Pin_Config), PORT_CHANNEL_PIN_NUM(Pin_Config)))
         {
-            /* No action required */
+            /* Locked pin, changes have to be committed through GPIOCR */
+            Image_Ptr->commit_mask |= Pin_Mask;
         }
         else
         {
-            SYSCTL_RCGCGPIO_REG |= (1 << ConfigPtr->Channels[Channel].port_num); /* Enable clock for the required port */
-            while ((SYSCTL_PRGPIO_REG & (1 << ConfigPtr->Channels[Channel].port_num)) == 0); /* wait until clock is setlled */
+            /* Do Nothing */
         }
 
-        if (((Port_Configurs->Channels[Channel].port_num == 3) && (Port_Configurs->Channels[Channel].pin_num == 7)) ||
-        ((Port_Configurs->Channels[Channel].port_num == 5) && (Port_Configurs->Channels[Channel].pin_num == 0)))
+        Image_Ptr->pins_mask |= Pin_Mask;
+        Image_Ptr->pctl_mask |= ((uint32)0x0000000F << (PORT_CHANNEL_PIN_NUM(Pin_Config) * 4));
+
+        if (PORT_CHANNEL_INITIAL_MODE(Pin_Config) == PORT_PIN_MODE_DIO)
         {
-            if (TRUE == error)
-            {
-                /* No action required */
-            }
-            else
-            {
-                /*
-                    * Unlock the GPIOCR register by providing the correct value
-                    * for each port before making any changes
-                */
-                *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_LOCK_REG_OFFSET) = 0x4C4F434B;
-
-                /* Set the corresponding bit in GPIOCR register to allow changes on this pin */
-                SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_COMMIT_REG_OFFSET), Port_Configurs->Channels[Channel].pin_num);
-            }
+            Image_Ptr->den |= Pin_Mask; /* Digital GPIO: AFSEL, AMSEL and PMCx stay cleared */
         }
-        else if ((Port_Configurs->Channels[Channel].port_num == 2) && (Port_Configurs->Channels[Channel].pin_num <= 3))
+        else if (PORT_CHANNEL_INITIAL_MODE(Pin_Config) == PORT_PIN_MODE_ADC)
         {
-            if (TRUE == error)
-            {
-                /* No action required */
-            }
-            else
-            {
-                /* Do Nothing
-                 * This is jtag pins */
-                continue;
-            }
+            Image_Ptr->amsel |= Pin_Mask; /* Analog: AFSEL, DEN and PMCx stay cleared */
         }
         else
         {
-            /* Do Nothing */
+            /* Alternative function: AMSEL stays cleared */
+            Image_Ptr->afsel |= Pin_Mask;
+            Image_Ptr->den |= Pin_Mask;
+            Image_Ptr->pctl |= (PORT_MODE_TO_PMC(PORT_CHANNEL_INITIAL_MODE(Pin_Config)) << (PORT_CHANNEL_PIN_NUM(Pin_Config) * 4));
         }
 
-        if (Port_Configurs->Channels[Channel].initial_mode == PORT_PIN_MODE_DIO)
+        if (PORT_CHANNEL_DIRECTION(Pin_Config) == OUTPUT)
         {
-            CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET), Port_Configurs->Channels[Channel].pin_num); /* Disable Alternative function for this pin by clear the corresponding bit in GPIOAFSEL register */
-
-            CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET), Port_Configurs->Channels[Channel].pin_num); /* Clear the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin */
-
-            *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) &= ~(0x0000000F << (Port_Configurs->Channels[Channel].pin_num * 4)); /* Clear the PMCx bits for this pin */
-
-            SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET), Port_Configurs->Channels[Channel].pin_num); /* Set the corresponding bit in the GPIODEN register to enable digital functionality on this pin */
+            Image_Ptr->dir |= Pin_Mask;
         }
         else
         {
             /* Do Nothing */
         }
 
-        if (Port_Configurs->Channels[Channel].initial_mode==PORT_PIN_MODE_ADC)
+        if (PORT_CHANNEL_DIR_CHANGEABLE(Pin_Config) == STD_OFF)
         {
-            CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET), Port_Configurs->Channels[Channel].pin_num); /* Disable Alternative function for this pin by clear the corresponding bit in GPIOAFSEL register */
-
-            CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET), Port_Configurs->Channels[Channel].pin_num); /* Clear the corresponding bit in the GPIOAMSEL register to disable digital functionality on this pin */
-
-            *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) &= ~(0x0000000F << (Port_Configurs->Channels[Channel].pin_num * 4)); /* Clear the PMCx bits for this pin */
-
-            SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET), Port_Configurs->Channels[Channel].pin_num); /* Set the corresponding bit in the GPIOAMSEL register to enable analog functionality on this pin */
+            Image_Ptr->refresh_mask |= Pin_Mask; /* Direction is refreshed by Port_RefreshPortDirection */
         }
         else
         {
             /* Do Nothing */
         }
 
-        if (((Port_Configurs->Channels[Channel].initial_mode>=PORT_PIN_MODE_ALT1)&&(Port_Configurs->Channels[Channel].initial_mode<=PORT_PIN_MODE_ALT9))||
-         (Port_Configurs->Channels[Channel].initial_mode==PORT_PIN_MODE_ALT14) || (Port_Configurs->Channels[Channel].initial_mode==PORT_PIN_MODE_ALT15))
+        if (PORT_CHANNEL_RESISTOR(Pin_Config) == PULL_UP)
         {
-            CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET), Port_Configurs->Channels[Channel].pin_num); /* Clear the corresponding bit in the GPIOAMSEL register to disable digital functionality on this pin */
-
-            SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET), Port_Configurs->Channels[Channel].pin_num); /* Enable Alternative function for this pin by set the corresponding bit in GPIOAFSEL register */
-
-            *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) &= ~(0x0000000F << (Port_Configurs->Channels[Channel].pin_num * 4)); /* Clear the PMCx bits for this pin */
+            Image_Ptr->pur |= Pin_Mask;
+        }
+        else if (PORT_CHANNEL_RESISTOR(Pin_Config) == PULL_DOWN)
+        {
+            Image_Ptr->pdr |= Pin_Mask;
         }
         else
         {
             /* Do Nothing */
         }
 
-        if (Port_Configurs->Channels[Channel].direction==OUTPUT)
+        if (PORT_CHANNEL_INITIAL_VALUE(Pin_Config) == STD_HIGH)
         {
-            SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIR_REG_OFFSET), Port_Configurs->Channels[Channel].pin_num); /* Set the corresponding bit in the GPIODIR register to configure it as output pin */
+            Image_Ptr->data |= Pin_Mask;
         }
         else
         {
-            CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIR_REG_OFFSET), Port_Configurs->Channels[Channel].pin_num); /* Clear the corresponding bit in the GPIODIR register to configure it as input pin */
+            /* Do Nothing */
         }
+    }
+}
+
+#endif
+
+/************************************************************************************
+ * Service Name: Port_ApplyRegisterImages
+ * Description: Enable the clock of all the used ports with one RCGCGPIO write, then
+ *              write each register of each used port once, only the configured pins
+ *              of the port are changed.
+ ************************************************************************************/
+STATIC void Port_ApplyRegisterImages(void)
+{
+    uint8 Port;
+    uint32 Clock_Mask = 0;
+    volatile uint32 *PortGpio_Ptr = NULL_PTR; /* point to the required Port Registers base address */
+    const Port_RegisterImageType *Image_Ptr = NULL_PTR;
 
-        if (Port_Configurs->Channels[Channel].resistor==PULL_UP)
+    for (Port = 0; Port < PORT_NUMBER_OF_PORTS; Port++)
+    {
+        if (Port_Images[Port].pins_mask != 0)
         {
-            SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_PULL_UP_REG_OFFSET), Port_Configurs->Channels[Channel].pin_num); /* Set the corresponding bit in the GPIOPUR register to enable the internal pull-up pin */
+            Clock_Mask |= ((uint32)1 << Port);
         }
-        else{
+        else
+        {
             /* Do Nothing */
         }
+    }
 
+    SYSCTL_RCGCGPIO_REG |= Clock_Mask; /* Enable clock for all the required ports */
+    PORT_STATS_RMW(PORT_STATS_RCGCGPIO);
+    while ((PORT_STATS_READ(PORT_STATS_PRGPIO), (SYSCTL_PRGPIO_REG & Clock_Mask)) != Clock_Mask); /* wait until all the clocks are setlled */
 
-        if (Port_Configurs->Channels[Channel].resistor==PULL_DOWN)
+#if (PORT_AHB_PORTS_MASK != 0U)
+    /* Move the configured ports to the AHB aperture before any access through Port_BaseAddress */
+    SYSCTL_GPIOHBCTL_REG |= PORT_AHB_PORTS_MASK;
+    PORT_STATS_RMW(PORT_STATS_GPIOHBCTL);
+#endif
+
+    for (Port = 0; Port < PORT_NUMBER_OF_PORTS; Port++)
+    {
+        Image_Ptr = &Port_Images[Port];
+        if (Image_Ptr->pins_mask == 0)
         {
-            SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_PULL_DOWN_REG_OFFSET), Port_Configurs->Channels[Channel].pin_num); /* Set the corresponding bit in the GPIOPDR register to enable the internal pull-down pin */
+            /* Port is not used */
+            continue;
         }
         else
         {
             /* Do Nothing */
         }
 
+        PortGpio_Ptr = HW_REGISTER_ADDRESS(Port_BaseAddress[Port]);
+
+        if (Image_Ptr->commit_mask != 0)
+        {
+            /*
+             * Unlock the GPIOCR register by providing the correct value
+             * then allow changes on the locked pins
+             */
+            PORT_REG(PortGpio_Ptr, PORT_LOCK_REG_OFFSET) = PORT_UNLOCK_KEY;
+            PORT_STATS_WRITE(PORT_STATS_LOCK);
+            PORT_REG(PortGpio_Ptr, PORT_COMMIT_REG_OFFSET) |= Image_Ptr->commit_mask;
+            PORT_STATS_RMW(PORT_STATS_CR);
+        }
+        else
+        {
+            /* Do Nothing */
+        }
 
-        if (Port_Configurs->Channels[Channel].initial_value==STD_HIGH)
+        /* Pin function selection: alternative function, analog mode and PMCx */
+        PORT_REG(PortGpio_Ptr, PORT_ALT_FUNC_REG_OFFSET) = (PORT_REG(PortGpio_Ptr, PORT_ALT_FUNC_REG_OFFSET) & ~(Image_Ptr->pins_mask)) | Image_Ptr->afsel;
+        PORT_STATS_RMW(PORT_STATS_AFSEL);
+        PORT_REG(PortGpio_Ptr, PORT_ANALOG_MODE_SEL_REG_OFFSET) = (PORT_REG(PortGpio_Ptr, PORT_ANALOG_MODE_SEL_REG_OFFSET) & ~(Image_Ptr->pins_mask)) | Image_Ptr->amsel;
+        PORT_STATS_RMW(PORT_STATS_AMSEL);
+        PORT_REG(PortGpio_Ptr, PORT_CTL_REG_OFFSET) = (PORT_REG(PortGpio_Ptr, PORT_CTL_REG_OFFSET) & ~(Image_Ptr->pctl_mask)) | Image_Ptr->pctl;
+        PORT_STATS_RMW(PORT_STATS_PCTL);
+
+        /* Internal resistors */
+        PORT_REG(PortGpio_Ptr, PORT_PULL_UP_REG_OFFSET) = (PORT_REG(PortGpio_Ptr, PORT_PULL_UP_REG_OFFSET) & ~(Image_Ptr->pins_mask)) | Image_Ptr->pur;
+        PORT_STATS_RMW(PORT_STATS_PUR);
+        PORT_REG(PortGpio_Ptr, PORT_PULL_DOWN_REG_OFFSET) = (PORT_REG(PortGpio_Ptr, PORT_PULL_DOWN_REG_OFFSET) & ~(Image_Ptr->pins_mask)) | Image_Ptr->pdr;
+        PORT_STATS_RMW(PORT_STATS_PDR);
+
+        /* Initial values are written through the GPIODATA alias of the configured pins before they become outputs */
+        PORT_REG(PortGpio_Ptr, (Image_Ptr->pins_mask << 2)) = Image_Ptr->data;
+        PORT_STATS_WRITE(PORT_STATS_DATA);
+
+        PORT_REG(PortGpio_Ptr, PORT_DIR_REG_OFFSET) = (PORT_REG(PortGpio_Ptr, PORT_DIR_REG_OFFSET) & ~(Image_Ptr->pins_mask)) | Image_Ptr->dir;
+        PORT_STATS_RMW(PORT_STATS_DIR);
+        PORT_REG(PortGpio_Ptr, PORT_DIGITAL_ENABLE_REG_OFFSET) = (PORT_REG(PortGpio_Ptr, PORT_DIGITAL_ENABLE_REG_OFFSET) & ~(Image_Ptr->pins_mask)) | Image_Ptr->den;
+        PORT_STATS_RMW(PORT_STATS_DEN);
+
+        if (Image_Ptr->commit_mask != 0)
         {
-            SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DATA_REG_OFFSET), Port_Configurs->Channels[Channel].pin_num); /* Set the corresponding bit in the GPIODATA register to provide initial value 1 */
+            PORT_REG(PortGpio_Ptr, PORT_LOCK_REG_OFFSET) = 0; /* Lock the GPIOCR register again */
+            PORT_STATS_WRITE(PORT_STATS_LOCK);
         }
         else
         {
-            CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DATA_REG_OFFSET), Port_Configurs->Channels[Channel].pin_num); /* Clear the corresponding bit in the GPIODATA register to provide initial value 0 */
+            /* Do Nothing */
         }
-        Channel++;
+    }
+}
+
+/************************************************************************************
+ * Service Name: Port_SetupGpioPin
+ * Sync/Async: Synchronous
+ * service ID[hex]: 0x00
+ * Reentrancy: reentrant
+ * Parameters (in): ConfigPtr - Pointer to post-build configuration data
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function to Setup the pin configuration:
+ *              - Setup the pin as Digital GPIO pin
+ *              - Setup the direction of the GPIO pin
+ *              - Provide initial value for o/p pin
+ *              - Setup the internal resistor for i/p pin
+ ************************************************************************************/
+/**
+ * @brief Function to Setup the GPIO pin configuration.
+ *
+ * This function initializes and configures a GPIO pin as per the provided
+ * configuration. It sets up the pin as a Digital GPIO pin, determines the
+ * pin direction (input/output), assigns an initial value for the output pin,
+ * and configures internal resistors for input pins.
+ *
+ * @param[in] ConfigPtr Pointer to post-build configuration data.
+ * 
+ * @details 
+ * The function performs the following operations:
+ * - Checks for a valid configuration pointer.
+ * - Aggregates all configured pins into one register image per port.
+ * - Enables the clock of all the used ports with a single RCGCGPIO write.
+ * - Writes each register of each used port once:
+ *   - Sets the pins as digital GPIO, analog or alternative function pins.
+ *   - Configures the pins' internal resistor type.
+ *   - Provides the initial output value of the pins then their direction.
+ *
+ * Reentrancy: Reentrant
+ * 
+ * Sync/Async: Synchronous
+ * 
+ * Service ID: 0x00
+ * 
+ * Errors:
+ * - Reports an error if the configuration pointer is NULL.
+ * 
+ * @return None
+ * 
+ * 
+ */
+///@code
+void Port_Init(const Port_ConfigType *ConfigPtr)
+{
+    boolean error = FALSE;
+
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+    /* Check if the input configuration pointer is not a NULL_PTR */
+    if (ConfigPtr == NULL_PTR)
+    {
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_INIT_SID, PORT_E_PARAM_CONFIG);
+        error = TRUE;
+    }
+    else
+    {
+        /* No action required */
+    }
+#endif
+
+    if (TRUE == error)
+    {
+        /* No action required */
+    }
+    else
+    {
+#if (PORT_INIT_INSTRUMENTATION == STD_ON)
+        /* The statistics always describe the last Port_Init call */
+        Port_ResetInitStats();
+#endif
+
+#if (PORT_PRECOMPUTED_REGISTER_IMAGES == STD_ON)
+        /* The register images are computed at build time with the configuration */
+        Port_Images = ConfigPtr->Images;
+#else
+        /* Aggregate the pins configuration into one value per register per port */
+        Port_BuildRegisterImages(ConfigPtr);
+        Port_Images = Port_RegisterImages;
+#endif
+
+        /* Write each register of each used port once */
+        Port_ApplyRegisterImages();
+
+        Port_Status = PORT_INITIALIZED;
+        Port_Configurs = ConfigPtr;
+
+#if (PORT_INIT_INSTRUMENTATION == STD_ON)
+        Port_InitStats.EstimatedBusCycles = Port_EstimateBusCycles();
+#endif
     }
 }
 /**
@@ -304,7 +460,6 @@ void Port_Init(const Port_ConfigType *ConfigPtr)
 void Port_SetPinDirection(Port_PinType Pin, Port_PinDirection Direction)
 {
     boolean error = FALSE;
-    volatile uint32 *PortGpio_Ptr = NULL_PTR; /* point to the required Port Registers base address */
 
     if (Port_Status == PORT_NOT_INITIALIZED)
     {
@@ -330,7 +485,7 @@ void Port_SetPinDirection(Port_PinType Pin, Port_PinDirection Direction)
         /* No action required */
     }
 
-    if (Port_Configurs->Channels[Pin].pin_dir_changeable == STD_OFF)
+    if ((FALSE == error) && (PORT_CHANNEL_DIR_CHANGEABLE(Port_Configurs->Channels[Pin]) == STD_OFF))
     {
 #if (PORT_DEV_ERROR_DETECT == STD_ON)
         Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_DIRECTION_SID, PORT_E_DIRECTION_UNCHANGEABLE);
@@ -349,56 +504,47 @@ void Port_SetPinDirection(Port_PinType Pin, Port_PinDirection Direction)
     }
     else
     {
-        switch (Port_Configurs->Channels[Pin].port_num)
-        {
-        case 0:
-            PortGpio_Ptr = (volatile uint32 *)GPIO_PORTA_BASE_ADDRESS;
-            break;
-        case 1:
-            PortGpio_Ptr = (volatile uint32 *)GPIO_PORTB_BASE_ADDRESS;
-            break;
-        case 2:
-            PortGpio_Ptr = (volatile uint32 *)GPIO_PORTC_BASE_ADDRESS;
-            break;
-        case 3:
-            PortGpio_Ptr = (volatile uint32 *)GPIO_PORTD_BASE_ADDRESS;
-            break;
-        case 4:
-            PortGpio_Ptr = (volatile uint32 *)GPIO_PORTE_BASE_ADDRESS;
-            break;
-        case 5:
-            PortGpio_Ptr = (volatile uint32 *)GPIO_PORTF_BASE_ADDRESS;
-            break;
-        default:
-            break;
-        }
-
-        //checking for jtag pins
-        if ((Port_Configurs->Channels[Pin].port_num == 2) && (Port_Configurs->Channels[Pin].pin_num <= 3))
-        {
-            
-             /* This is jtag pins */
-            return;
-        }
-        else
-        {
-            /* Do Nothing */
-        }
-
-        if (Direction == OUTPUT)
-        {
-            SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIR_REG_OFFSET), Port_Configurs->Channels[Pin].pin_num); /* Set the corresponding bit in the GPIODIR register to configure it as output pin */
-        }
-        else
-        {
-            CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIR_REG_OFFSET), Port_Configurs->Channels[Pin].pin_num); /* Clear the corresponding bit in the GPIODIR register to configure it as input pin */
-        }
+        Port_SetPinDirection_Fast(Pin, Direction);
     }
 
 }
 
 ///@endcode
 
+/************************************************************************************
+ * Service Name: Port_SetPinDirection_Fast
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): Pin - Port Pin ID number
+ *                 Direction - Port Pin Direction
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function to Set the port pin direction without the development error checks,
+ *              the caller must guarantee the module is initialized, the Pin is valid
+ *              and its direction is changeable.
+ ************************************************************************************/
+///@code
+void Port_SetPinDirection_Fast(Port_PinType Pin, Port_PinDirection Direction)
+{
+    volatile uint32 *PortGpio_Ptr = HW_REGISTER_ADDRESS(Port_BaseAddress[PORT_CHANNEL_PORT_NUM(Port_Configurs->Channels[Pin])]); /* point to the required Port Registers base address */
+
+    //checking for jtag pins
+    if (PORT_IS_JTAG_PIN(PORT_CHANNEL_PORT_NUM(Port_Configurs->Channels[Pin]), PORT_CHANNEL_PIN_NUM(Port_Configurs->Channels[Pin])))
+    {
+         /* This is jtag pins */
+    }
+    else if (Direction == OUTPUT)
+    {
+        SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIR_REG_OFFSET), PORT_CHANNEL_PIN_NUM(Port_Configurs->Channels[Pin])); /* Set the corresponding bit in the GPIODIR register to configure it as output pin */
+    }
+    else
+    {
+        CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIR_REG_OFFSET), PORT_CHANNEL_PIN_NUM(Port_Configurs->Channels[Pin])); /* Clear the corresponding bit in the GPIODIR register to configure it as input pin */
+    }
+}
+///@endcode
+
 #endif
 
 /************************************************************************************
@@ -410,7 +556,8 @@ void Port_SetPinDirection(Port_PinType Pin, Port_PinDirection Direction)
  * Parameters (inout): None
  * Parameters (out): None
  * Return value: None
- * Description: Function to Refresh the port direction
+ * Description: Function to Refresh the port direction of the pins whose direction is
+ *              not changeable, with at most one GPIODIR write per port.
  ************************************************************************************/
 
 #if (PORT_SET_PIN_DIRECTION_API == STD_ON)
@@ -420,7 +567,10 @@ void Port_RefreshPortDirection(void)
 {
     boolean error = FALSE;
     volatile uint32 *PortGpio_Ptr = NULL_PTR; /* point to the required Port Registers base address */
-    uint8 Channel;
+    uint8 Port;
+    uint32 Dir_Value;
+    uint32 Drift_Mask;
+
     if (Port_Status == PORT_NOT_INITIALIZED)
     {
 #if (PORT_DEV_ERROR_DETECT == STD_ON)
@@ -439,67 +589,84 @@ void Port_RefreshPortDirection(void)
     }
     else
     {
-        for (Channel = 0; Channel <(uint8)PORT_CONFIGURED_PINS; Channel++)
+        /*
+         * The expected direction of the refreshed pins (direction not changeable, JTAG pins
+         * excluded) is in the register images, each port is read once and written only
+         * when one of its pins has drifted.
+         */
+        for (Port = 0; Port < PORT_NUMBER_OF_PORTS; Port++)
         {
-            switch (Port_Configurs->Channels[Channel].port_num)
-            {
-            case 0:
-                PortGpio_Ptr = (volatile uint32 *)GPIO_PORTA_BASE_ADDRESS;
-                break;
-            case 1:
-                PortGpio_Ptr = (volatile uint32 *)GPIO_PORTB_BASE_ADDRESS;
-                break;
-            case 2:
-                PortGpio_Ptr = (volatile uint32 *)GPIO_PORTC_BASE_ADDRESS;
-                break;
-            case 3:
-                PortGpio_Ptr = (volatile uint32 *)GPIO_PORTD_BASE_ADDRESS;
-                break;
-            case 4:
-                PortGpio_Ptr = (volatile uint32 *)GPIO_PORTE_BASE_ADDRESS;
-                break;
-            case 5:
-                PortGpio_Ptr = (volatile uint32 *)GPIO_PORTF_BASE_ADDRESS;
-                break;
-            default:
-                break;
-            }
-            //checking for jtag pins
-            if ((Port_Configurs->Channels[Channel].port_num == 2) && (Port_Configurs->Channels[Channel].pin_num <= 3))
+            Drift_Mask = 0;
+
+            if (Port_Images[Port].refresh_mask != 0)
             {
-                /* This is jtag pins */
-                continue;
+                PortGpio_Ptr = HW_REGISTER_ADDRESS(Port_BaseAddress[Port]);
+                Dir_Value = PORT_REG(PortGpio_Ptr, PORT_DIR_REG_OFFSET);
+                Drift_Mask = (Dir_Value ^ Port_Images[Port].dir) & Port_Images[Port].refresh_mask;
+
+                if (Drift_Mask != 0)
+                {
+                    PORT_REG(PortGpio_Ptr, PORT_DIR_REG_OFFSET) = Dir_Value ^ Drift_Mask; /* Flip back only the drifted pins */
+                }
+                else
+                {
+                    /* Do Nothing */
+                }
             }
             else
             {
                 /* Do Nothing */
             }
 
-            if (Port_Configurs->Channels[Channel].direction == OUTPUT)
-            {
-                SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIR_REG_OFFSET), Port_Configurs->Channels[Channel].pin_num); /* Set the corresponding bit in the GPIODIR register to configure it as output pin */
-            }
-            else
-            {
-                CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIR_REG_OFFSET), Port_Configurs->Channels[Channel].pin_num); /* Clear the corresponding bit in the GPIODIR register to configure it as input pin */
-            }
+            Port_DirectionDrift.DriftMask[Port] = (uint8)Drift_Mask;
         }
     }
-
 }
 ///@endcode
-#endif
 
 /************************************************************************************
- * Service Name: Port_GetVersionInfo
+ * Service Name: Port_GetDirectionDrift
  * Sync/Async: Synchronous
- * Service ID[hex]: 0x03
+ * Service ID[hex]: 0x12 (Not exist in AUTOSAR 4.0.3 PORT SWS Document)
  * Reentrancy: non reentrant
  * Parameters (in): None
  * Parameters (inout): None
- * Parameters (out): versioninfo - Pointer to where to store the version information of this module.
+ * Parameters (out): DriftPtr - Pointer to where to store the drifted pins of each port.
  * Return value: None
- * Description: Function to get the version information of this module.
+ * Description: Function to get the pins corrected by the last Port_RefreshPortDirection call.
+ ************************************************************************************/
+///@code
+void Port_GetDirectionDrift(Port_DirectionDriftType *DriftPtr)
+{
+    uint8 Port;
+
+    if (DriftPtr == NULL_PTR)
+    {
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_GET_DIRECTION_DRIFT_SID, PORT_E_PARAM_POINTER);
+#endif
+    }
+    else
+    {
+        for (Port = 0; Port < PORT_NUMBER_OF_PORTS; Port++)
+        {
+            DriftPtr->DriftMask[Port] = Port_DirectionDrift.DriftMask[Port];
+        }
+    }
+}
+///@endcode
+#endif
+
+/************************************************************************************
+ * Service Name: Port_GetVersionInfo
+ * Sync/Async: Synchronous
+ * Service ID[hex]: 0x03
+ * Reentrancy: non reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): versioninfo - Pointer to where to store the version information of this module.
+ * Return value: None
+ * Description: Function to get the version information of this module.
  ************************************************************************************/
 
 #if (PORT_VERSION_INFO_API == STD_ON)
@@ -554,7 +721,6 @@ void Port_GetVersionInfo(Std_VersionInfoType *versioninfo)
 void Port_SetPinMode(Port_PinType Pin, Port_PinModeType Mode)
 {
     boolean error = FALSE;
-    volatile uint32 *PortGpio_Ptr = NULL_PTR; /* point to the required Port Registers base address */
 
     if (Port_Status == PORT_NOT_INITIALIZED)
     {
@@ -580,7 +746,19 @@ void Port_SetPinMode(Port_PinType Pin, Port_PinModeType Mode)
         /* No action required */
     }
 
-    if (Port_Configurs->Channels[Pin].pin_mode_changeable == STD_OFF)
+    if (Mode > PORT_PIN_MODE_DIO)
+    {
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_MODE_SID, PORT_E_PARAM_INVALID_MODE);
+#endif
+        error = TRUE;
+    }
+    else
+    {
+        /* No action required */
+    }
+
+    if ((FALSE == error) && (PORT_CHANNEL_MODE_CHANGEABLE(Port_Configurs->Channels[Pin]) == STD_OFF))
     {
 #if (PORT_DEV_ERROR_DETECT == STD_ON)
         Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_MODE_SID, PORT_E_MODE_UNCHANGEABLE);
@@ -598,68 +776,480 @@ void Port_SetPinMode(Port_PinType Pin, Port_PinModeType Mode)
     }
     else
     {
-        switch (Port_Configurs->Channels[Pin].port_num)
+        Port_SetPinMode_Fast(Pin, Mode);
+    }
+}
+///@endcode
+
+/************************************************************************************
+ * Service Name: Port_SetPinMode_Fast
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): Pin - Port Pin ID number
+ *                 Mode - New Port Pin mode to be set on the port pin
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function to Set the port pin mode without the development error checks,
+ *              the caller must guarantee the module is initialized, the Pin is valid
+ *              and its mode is changeable. The pin is disconnected from its old
+ *              function before the new one is enabled so it never drives both.
+ ************************************************************************************/
+///@code
+void Port_SetPinMode_Fast(Port_PinType Pin, Port_PinModeType Mode)
+{
+    Port_ConfigChannel Pin_Config = Port_Configurs->Channels[Pin];
+    uint8 Pin_Num = PORT_CHANNEL_PIN_NUM(Pin_Config);
+    uint32 Pin_Mask = ((uint32)1 << Pin_Num);
+    uint32 Pctl_Mask = ((uint32)0x0000000F << (Pin_Num * 4));
+    uint32 Pctl_Value = (PORT_MODE_TO_PMC(Mode) << (Pin_Num * 4));
+    volatile uint32 *PortGpio_Ptr = HW_REGISTER_ADDRESS(Port_BaseAddress[PORT_CHANNEL_PORT_NUM(Pin_Config)]); /* point to the required Port Registers base address */
+
+    if (PORT_IS_LOCKED_PIN(PORT_CHANNEL_PORT_NUM(Pin_Config), Pin_Num))
+    {
+        /* Unlock the GPIOCR register then allow changes on the locked pin, same as Port_Init */
+        PORT_REG(PortGpio_Ptr, PORT_LOCK_REG_OFFSET) = PORT_UNLOCK_KEY;
+        PORT_REG(PortGpio_Ptr, PORT_COMMIT_REG_OFFSET) |= Pin_Mask;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+    /*
+     * The new value of every register is known from the mode, the registers are written
+     * in an order that never connects the pin to two functions at the same time:
+     * the old path is disconnected first and the new one is enabled last.
+     */
+    if (Mode == PORT_PIN_MODE_ADC)
+    {
+        PORT_REG(PortGpio_Ptr, PORT_DIGITAL_ENABLE_REG_OFFSET) &= ~Pin_Mask; /* Disable digital functionality on this pin first */
+        PORT_REG(PortGpio_Ptr, PORT_ALT_FUNC_REG_OFFSET) &= ~Pin_Mask;       /* Disable Alternative function for this pin */
+        PORT_REG(PortGpio_Ptr, PORT_CTL_REG_OFFSET) &= ~Pctl_Mask;           /* Clear the PMCx bits for this pin */
+        PORT_REG(PortGpio_Ptr, PORT_ANALOG_MODE_SEL_REG_OFFSET) |= Pin_Mask; /* Enable analog functionality on this pin last */
+    }
+    else
+    {
+        /* DIO or alternative function: AFSEL is set and PMCx is written only for the alternative functions */
+        PORT_REG(PortGpio_Ptr, PORT_ANALOG_MODE_SEL_REG_OFFSET) &= ~Pin_Mask; /* Disable analog functionality on this pin first */
+        PORT_REG(PortGpio_Ptr, PORT_CTL_REG_OFFSET) = (PORT_REG(PortGpio_Ptr, PORT_CTL_REG_OFFSET) & ~Pctl_Mask) | Pctl_Value; /* Select the peripheral before routing it to the pin */
+        if (Mode == PORT_PIN_MODE_DIO)
         {
-        case 0:
-            PortGpio_Ptr = (volatile uint32 *)GPIO_PORTA_BASE_ADDRESS;
-            break;
-        case 1:
-            PortGpio_Ptr = (volatile uint32 *)GPIO_PORTB_BASE_ADDRESS;
-            break;
-        case 2:
-            PortGpio_Ptr = (volatile uint32 *)GPIO_PORTC_BASE_ADDRESS;
-            break;
-        case 3:
-            PortGpio_Ptr = (volatile uint32 *)GPIO_PORTD_BASE_ADDRESS;
-            break;
-        case 4:
-            PortGpio_Ptr = (volatile uint32 *)GPIO_PORTE_BASE_ADDRESS;
-            break;
-        case 5:
-            PortGpio_Ptr = (volatile uint32 *)GPIO_PORTF_BASE_ADDRESS;
-            break;
-        default:
-            break;
+            PORT_REG(PortGpio_Ptr, PORT_ALT_FUNC_REG_OFFSET) &= ~Pin_Mask; /* The pin is driven by GPIODATA */
         }
+        else
+        {
+            PORT_REG(PortGpio_Ptr, PORT_ALT_FUNC_REG_OFFSET) |= Pin_Mask;  /* The pin is driven by the selected peripheral */
+        }
+        PORT_REG(PortGpio_Ptr, PORT_DIGITAL_ENABLE_REG_OFFSET) |= Pin_Mask; /* Enable digital functionality on this pin last */
+    }
+
+    if (PORT_IS_LOCKED_PIN(PORT_CHANNEL_PORT_NUM(Pin_Config), Pin_Num))
+    {
+        PORT_REG(PortGpio_Ptr, PORT_LOCK_REG_OFFSET) = 0; /* Lock the GPIOCR register again */
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+}
+///@endcode
+
 
-        if (Mode == PORT_PIN_MODE_ADC)
+
+#if (PORT_SET_PINS_MODE_MASKED_API == STD_ON)
+/************************************************************************************
+ * Service Name: Port_SetPinsModeMasked
+ * Sync/Async: Synchronous
+ * Service ID[hex]: 0x11 (Not exist in AUTOSAR 4.0.3 PORT SWS Document)
+ * Reentrancy: reentrant
+ * Parameters (in): Port - Port ID number
+ *                 PinsMask - Pins of the port to be changed (bit n for pin n)
+ *                 Mode - New Port Pin mode to be set on the pins
+ *                 Direction - New Port Pin direction to be set on the pins
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function to Set the mode and the direction of several pins of one port,
+ *              the pins are validated once then each register is written once.
+ ************************************************************************************/
+///@code
+void Port_SetPinsModeMasked(Port_PortType Port, uint8 PinsMask, Port_PinModeType Mode, Port_PinDirection Direction)
+{
+    boolean error = FALSE;
+    uint8 Channel;
+    uint32 Configured_Mask = 0;
+    uint32 Dir_Changeable_Mask = 0;
+    uint32 Mode_Changeable_Mask = 0;
+
+    if (Port_Status == PORT_NOT_INITIALIZED)
+    {
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PINS_MODE_MASKED_SID, PORT_E_UNINIT);
+#endif
+        error = TRUE;
+    }
+    else
+    {
+        /* Collect the configured pins of the port and their changeable flags in one pass */
+        for (Channel = 0; Channel < PORT_CONFIGURED_PINS; Channel++)
         {
-            CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET), Port_Configurs->Channels[Pin].pin_num); /* Disable Alternative function for this pin by clear the corresponding bit in GPIOAFSEL register */
+            Port_ConfigChannel Pin_Config = Port_Configurs->Channels[Channel];
+            uint32 Pin_Mask = ((uint32)1 << PORT_CHANNEL_PIN_NUM(Pin_Config));
 
-            CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET), Port_Configurs->Channels[Pin].pin_num); /* Clear the corresponding bit in the GPIOAMSEL register to disable digital functionality on this pin */
+            if ((PORT_CHANNEL_PORT_NUM(Pin_Config) != Port) ||
+                PORT_IS_JTAG_PIN(PORT_CHANNEL_PORT_NUM(Pin_Config), PORT_CHANNEL_PIN_NUM(Pin_Config)))
+            {
+                continue;
+            }
+            else
+            {
+                /* Do Nothing */
+            }
 
-            *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) &= ~(0x0000000F << (Port_Configurs->Channels[Pin].pin_num * 4)); /* Clear the PMCx bits for this pin */
+            Configured_Mask |= Pin_Mask;
+            if (PORT_CHANNEL_DIR_CHANGEABLE(Pin_Config) == STD_ON)
+            {
+                Dir_Changeable_Mask |= Pin_Mask;
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+            if (PORT_CHANNEL_MODE_CHANGEABLE(Pin_Config) == STD_ON)
+            {
+                Mode_Changeable_Mask |= Pin_Mask;
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+        }
+    }
 
-            SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET), Port_Configurs->Channels[Pin].pin_num); /* Set the corresponding bit in the GPIOAMSEL register to enable analog functionality on this pin */
+    if ((FALSE == error) && ((Port >= PORT_NUMBER_OF_PORTS) || (PinsMask == 0) || ((PinsMask & ~Configured_Mask) != 0)))
+    {
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PINS_MODE_MASKED_SID, PORT_E_PARAM_PIN);
+#endif
+        error = TRUE;
+    }
+    else
+    {
+        /* No action required */
+    }
+
+    if (Mode > PORT_PIN_MODE_DIO)
+    {
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PINS_MODE_MASKED_SID, PORT_E_PARAM_INVALID_MODE);
+#endif
+        error = TRUE;
+    }
+    else
+    {
+        /* No action required */
+    }
+
+    if ((FALSE == error) && ((PinsMask & ~Dir_Changeable_Mask) != 0))
+    {
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PINS_MODE_MASKED_SID, PORT_E_DIRECTION_UNCHANGEABLE);
+#endif
+        error = TRUE;
+    }
+    else
+    {
+        /* No action required */
+    }
+
+    if ((FALSE == error) && ((PinsMask & ~Mode_Changeable_Mask) != 0))
+    {
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PINS_MODE_MASKED_SID, PORT_E_MODE_UNCHANGEABLE);
+#endif
+        error = TRUE;
+    }
+    else
+    {
+        /* No action required */
+    }
+
+    if (TRUE == error)
+    {
+        /* No action required */
+    }
+    else
+    {
+        Port_SetPinsModeMasked_Fast(Port, PinsMask, Mode, Direction);
+    }
+}
+///@endcode
+
+/************************************************************************************
+ * Service Name: Port_SetPinsModeMasked_Fast
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): Port - Port ID number
+ *                 PinsMask - Pins of the port to be changed (bit n for pin n)
+ *                 Mode - New Port Pin mode to be set on the pins
+ *                 Direction - New Port Pin direction to be set on the pins
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function to Set the mode and the direction of several pins of one port
+ *              without the development error checks. The registers are written in the
+ *              same order as Port_SetPinMode_Fast, a pin turned to input stops driving
+ *              before its mode changes and a pin turned to output starts driving after.
+ ************************************************************************************/
+///@code
+void Port_SetPinsModeMasked_Fast(Port_PortType Port, uint8 PinsMask, Port_PinModeType Mode, Port_PinDirection Direction)
+{
+    uint8 Pin_Num;
+    uint32 Pins_Mask = (uint32)PinsMask;
+    uint32 Commit_Mask = Pins_Mask & PORT_LOCKED_PINS_MASK(Port);
+    uint32 Pctl_Mask = 0;
+    uint32 Pctl_Value = 0;
+    volatile uint32 *PortGpio_Ptr = HW_REGISTER_ADDRESS(Port_BaseAddress[Port]); /* point to the required Port Registers base address */
+
+    for (Pin_Num = 0; Pin_Num < 8; Pin_Num++)
+    {
+        if ((Pins_Mask & ((uint32)1 << Pin_Num)) != 0)
+        {
+            Pctl_Mask |= ((uint32)0x0000000F << (Pin_Num * 4));
+            Pctl_Value |= (PORT_MODE_TO_PMC(Mode) << (Pin_Num * 4));
         }
         else
         {
             /* Do Nothing */
         }
+    }
 
+    if (Commit_Mask != 0)
+    {
+        /* Unlock the GPIOCR register then allow changes on the locked pins, same as Port_Init */
+        PORT_REG(PortGpio_Ptr, PORT_LOCK_REG_OFFSET) = PORT_UNLOCK_KEY;
+        PORT_REG(PortGpio_Ptr, PORT_COMMIT_REG_OFFSET) |= Commit_Mask;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+    if (Direction == INPUT)
+    {
+        PORT_REG(PortGpio_Ptr, PORT_DIR_REG_OFFSET) &= ~Pins_Mask; /* Stop driving the pins before changing their mode */
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+    if (Mode == PORT_PIN_MODE_ADC)
+    {
+        PORT_REG(PortGpio_Ptr, PORT_DIGITAL_ENABLE_REG_OFFSET) &= ~Pins_Mask; /* Disable digital functionality first */
+        PORT_REG(PortGpio_Ptr, PORT_ALT_FUNC_REG_OFFSET) &= ~Pins_Mask;
+        PORT_REG(PortGpio_Ptr, PORT_CTL_REG_OFFSET) &= ~Pctl_Mask;
+        PORT_REG(PortGpio_Ptr, PORT_ANALOG_MODE_SEL_REG_OFFSET) |= Pins_Mask; /* Enable analog functionality last */
+    }
+    else
+    {
+        PORT_REG(PortGpio_Ptr, PORT_ANALOG_MODE_SEL_REG_OFFSET) &= ~Pins_Mask; /* Disable analog functionality first */
+        PORT_REG(PortGpio_Ptr, PORT_CTL_REG_OFFSET) = (PORT_REG(PortGpio_Ptr, PORT_CTL_REG_OFFSET) & ~Pctl_Mask) | Pctl_Value;
         if (Mode == PORT_PIN_MODE_DIO)
         {
-            CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET), Port_Configurs->Channels[Pin].pin_num); /* Disable Alternative function for this pin by clear the corresponding bit in GPIOAFSEL register */
+            PORT_REG(PortGpio_Ptr, PORT_ALT_FUNC_REG_OFFSET) &= ~Pins_Mask;
+        }
+        else
+        {
+            PORT_REG(PortGpio_Ptr, PORT_ALT_FUNC_REG_OFFSET) |= Pins_Mask;
+        }
+        PORT_REG(PortGpio_Ptr, PORT_DIGITAL_ENABLE_REG_OFFSET) |= Pins_Mask; /* Enable digital functionality last */
+    }
+
+    if (Direction == OUTPUT)
+    {
+        PORT_REG(PortGpio_Ptr, PORT_DIR_REG_OFFSET) |= Pins_Mask; /* Start driving the pins once their mode is set */
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+    if (Commit_Mask != 0)
+    {
+        PORT_REG(PortGpio_Ptr, PORT_LOCK_REG_OFFSET) = 0; /* Lock the GPIOCR register again */
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+}
+///@endcode
+#endif
+
+/************************************************************************************
+ * Service Name: Port_GetInitStats
+ * Sync/Async: Synchronous
+ * Reentrancy: non reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): StatsPtr - Pointer to where to store the register access statistics of the last Port_Init call.
+ * Return value: None
+ * Description: Function to get the register read/write counts and the estimated bus cycles of the last Port_Init call.
+ ************************************************************************************/
+
+#if (PORT_INIT_INSTRUMENTATION == STD_ON)
+
+///@code
+void Port_GetInitStats(Port_InitStatsType *StatsPtr)
+{
+    uint8 Reg;
+
+    if (StatsPtr == NULL_PTR)
+    {
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_GET_INIT_STATS_SID, PORT_E_PARAM_POINTER);
+#endif
+    }
+    else
+    {
+        for (Reg = 0; Reg < PORT_STATS_REGS_NUMBER; Reg++)
+        {
+            StatsPtr->ReadCount[Reg] = Port_InitStats.ReadCount[Reg];
+            StatsPtr->WriteCount[Reg] = Port_InitStats.WriteCount[Reg];
+        }
+        StatsPtr->EstimatedBusCycles = Port_InitStats.EstimatedBusCycles;
+    }
+}
+///@endcode
+#endif
+
+#if (PORT_PIN_EDGE_NOTIFICATION_API == STD_ON)
+/************************************************************************************
+ * Service Name: Port_SetPinEdgeNotification
+ * Sync/Async: Synchronous
+ * Reentrancy: non reentrant
+ * Parameters (in): Pin - Port Pin ID number
+ *                  Edge - Edges triggering the notification, PORT_PIN_EDGE_NONE to disable the pin interrupt
+ *                  Notification - Function called from the GPIO interrupt on each edge of the pin
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function to configure the edge interrupt of a pin:
+ *              - Mask the pin interrupt while it is reconfigured
+ *              - Select the edge sensitivity (GPIOIS = 0) and the edges (GPIOIBE/GPIOIEV)
+ *              - Clear any edge latched before the notification is installed
+ *              - Unmask the pin interrupt and enable the GPIO interrupt of the port in the NVIC
+ ************************************************************************************/
+///@code
+void Port_SetPinEdgeNotification(Port_PinType Pin, Port_PinEdgeType Edge, Port_PinNotificationType Notification)
+{
+    boolean error = FALSE;
+    volatile uint32 *PortGpio_Ptr = NULL_PTR;
+    uint8 Port_Num;
+    uint32 Pin_Mask;
 
-            CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET), Port_Configurs->Channels[Pin].pin_num); /* Clear the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin */
+    if (Port_Status == PORT_NOT_INITIALIZED)
+    {
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_EDGE_NOTIFICATION_SID, PORT_E_UNINIT);
+#endif
+        error = TRUE;
+    }
+    else if (Pin >= PORT_CONFIGURED_PINS)
+    {
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_EDGE_NOTIFICATION_SID, PORT_E_PARAM_PIN);
+#endif
+        error = TRUE;
+    }
+    else if (Edge > PORT_PIN_EDGE_BOTH)
+    {
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_EDGE_NOTIFICATION_SID, PORT_E_PARAM_EDGE);
+#endif
+        error = TRUE;
+    }
+    else if ((Edge != PORT_PIN_EDGE_NONE) && (Notification == NULL_PTR))
+    {
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_EDGE_NOTIFICATION_SID, PORT_E_PARAM_POINTER);
+#endif
+        error = TRUE;
+    }
+    else
+    {
+        /* No action required */
+    }
 
-            *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) &= ~(0x0000000F << (Port_Configurs->Channels[Pin].pin_num * 4)); /* Clear the PMCx bits for this pin */
+    if (TRUE == error)
+    {
+        /* No action required */
+    }
+    else
+    {
+        Port_Num = PORT_CHANNEL_PORT_NUM(Port_Configurs->Channels[Pin]);
+        Pin_Mask = (uint32)1 << PORT_CHANNEL_PIN_NUM(Port_Configurs->Channels[Pin]);
+        PortGpio_Ptr = HW_REGISTER_ADDRESS(Port_BaseAddress[Port_Num]); /* point to the required Port Registers base address */
 
-            SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET), Port_Configurs->Channels[Pin].pin_num); /* Set the corresponding bit in the GPIODEN register to enable digital functionality on this pin */
+        PORT_REG(PortGpio_Ptr, PORT_INT_MASK_REG_OFFSET) &= ~Pin_Mask;   /* Mask the pin interrupt while it is reconfigured */
+        PORT_REG(PortGpio_Ptr, PORT_INT_SENSE_REG_OFFSET) &= ~Pin_Mask;  /* Edge sensitive */
 
+        if (Edge == PORT_PIN_EDGE_BOTH)
+        {
+            PORT_REG(PortGpio_Ptr, PORT_INT_BOTH_EDGES_REG_OFFSET) |= Pin_Mask; /* Both edges, GPIOIEV is ignored */
         }
         else
         {
-            /* Do Nothing */
+            PORT_REG(PortGpio_Ptr, PORT_INT_BOTH_EDGES_REG_OFFSET) &= ~Pin_Mask;
+            if (Edge == PORT_PIN_EDGE_RISING)
+            {
+                PORT_REG(PortGpio_Ptr, PORT_INT_EVENT_REG_OFFSET) |= Pin_Mask;
+            }
+            else
+            {
+                PORT_REG(PortGpio_Ptr, PORT_INT_EVENT_REG_OFFSET) &= ~Pin_Mask;
+            }
         }
 
-        if (((Mode >= PORT_PIN_MODE_ALT1) && (Mode <= PORT_PIN_MODE_ALT9)) || (Mode == PORT_PIN_MODE_ALT14) || (Mode == PORT_PIN_MODE_ALT15))
+        PORT_REG(PortGpio_Ptr, PORT_INT_CLEAR_REG_OFFSET) = Pin_Mask; /* Drop the edges latched before */
+        Port_PinNotifications[Port_Num][PORT_CHANNEL_PIN_NUM(Port_Configurs->Channels[Pin])] = Notification;
+
+        if (Edge != PORT_PIN_EDGE_NONE)
         {
-            CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET), Port_Configurs->Channels[Pin].pin_num); /* Clear the corresponding bit in the GPIOAMSEL register to disable digital functionality on this pin */
+            PORT_REG(PortGpio_Ptr, PORT_INT_MASK_REG_OFFSET) |= Pin_Mask;
+            *(volatile uint8 *)HW_REGISTER_ADDRESS(PORT_NVIC_PRI_BASE_ADDRESS + PORT_IRQ_NUMBER(Port_Num)) = (uint8)(PORT_GPIO_INTERRUPT_PRIORITY << PORT_NVIC_PRIORITY_BITS_POS);
+            NVIC_EN0_REG = (uint32)1 << PORT_IRQ_NUMBER(Port_Num); /* Writing 0 to the other bits has no effect */
+        }
+        else
+        {
+            /* The pin interrupt stays masked, the port interrupt is left enabled for the other pins */
+        }
+    }
+}
+///@endcode
+
+/************************************************************************************
+ * Service Name: Port_PinsIrqHandler
+ * Description: Common part of the GPIO interrupt handlers, acknowledges the pending edges
+ *              of the port then calls the notification of each pin in ascending pin order.
+ ************************************************************************************/
+///@code
+STATIC void Port_PinsIrqHandler(Port_PortType Port)
+{
+    volatile uint32 *PortGpio_Ptr = HW_REGISTER_ADDRESS(Port_BaseAddress[Port]); /* point to the required Port Registers base address */
+    uint32 Pending = PORT_REG(PortGpio_Ptr, PORT_MASKED_INT_STATUS_REG_OFFSET);
+    uint8 Pin_Num;
 
-            SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET), Port_Configurs->Channels[Pin].pin_num); /* Enable Alternative function for this pin by set the corresponding bit in GPIOAFSEL register */
+    /* Acknowledge first so an edge during the notifications is latched again */
+    PORT_REG(PortGpio_Ptr, PORT_INT_CLEAR_REG_OFFSET) = Pending;
 
-            *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) &= ~(0x0000000F << (Port_Configurs->Channels[Pin].pin_num * 4)); /* Clear the PMCx bits for this pin */
+    for (Pin_Num = 0; Pending != 0; Pin_Num++, Pending >>= 1)
+    {
+        if (((Pending & 1U) != 0) && (Port_PinNotifications[Port][Pin_Num] != NULL_PTR))
+        {
+            Port_PinNotifications[Port][Pin_Num]();
         }
         else
         {
@@ -669,3 +1259,37 @@ void Port_SetPinMode(Port_PinType Pin, Port_PinModeType Mode)
 }
 ///@endcode
 
+/************************************************************************************
+ * Service Name: GPIOPortA_Handler .. GPIOPortF_Handler
+ * Description: GPIO Port A .. F ISRs
+ ************************************************************************************/
+void GPIOPortA_Handler(void)
+{
+    Port_PinsIrqHandler(0);
+}
+
+void GPIOPortB_Handler(void)
+{
+    Port_PinsIrqHandler(1);
+}
+
+void GPIOPortC_Handler(void)
+{
+    Port_PinsIrqHandler(2);
+}
+
+void GPIOPortD_Handler(void)
+{
+    Port_PinsIrqHandler(3);
+}
+
+void GPIOPortE_Handler(void)
+{
+    Port_PinsIrqHandler(4);
+}
+
+void GPIOPortF_Handler(void)
+{
+    Port_PinsIrqHandler(5);
+}
+#endif
@@ -56,7 +56,7 @@
  */
 #define PORT_INSTANCE_ID  (0U)
 
-/* GPIO Registers base addresses */
+/* GPIO Registers base addresses (APB aperture) */
 #define GPIO_PORTA_BASE_ADDRESS 0x40004000
 #define GPIO_PORTB_BASE_ADDRESS 0x40005000
 #define GPIO_PORTC_BASE_ADDRESS 0x40006000
@@ -64,6 +64,41 @@
 #define GPIO_PORTE_BASE_ADDRESS 0x40024000
 #define GPIO_PORTF_BASE_ADDRESS 0x40025000
 
+/* GPIO Registers base addresses (AHB aperture) */
+#define GPIO_PORTA_AHB_BASE_ADDRESS 0x40058000
+#define GPIO_PORTB_AHB_BASE_ADDRESS 0x40059000
+#define GPIO_PORTC_AHB_BASE_ADDRESS 0x4005A000
+#define GPIO_PORTD_AHB_BASE_ADDRESS 0x4005B000
+#define GPIO_PORTE_AHB_BASE_ADDRESS 0x4005C000
+#define GPIO_PORTF_AHB_BASE_ADDRESS 0x4005D000
+
+/* Base address used for a port: its AHB aperture if enabled in PORT_AHB_PORTS_MASK, its APB one otherwise */
+#define PORT_SELECT_BASE_ADDRESS(PORT, APB_ADDRESS, AHB_ADDRESS) \
+    (((PORT_AHB_PORTS_MASK & (1U << (PORT))) != 0U) ? (AHB_ADDRESS) : (APB_ADDRESS))
+
+/* Number of the GPIO ports (PORTA .. PORTF) */
+#define PORT_NUMBER_OF_PORTS (6U)
+
+/* Value written to GPIOLOCK to unlock the GPIOCR register */
+#define PORT_UNLOCK_KEY 0x4C4F434B
+
+/* Check if a pin is one of the JTAG pins (PC0 .. PC3) which are never configured */
+#define PORT_IS_JTAG_PIN(PORT, PIN) (((PORT) == 2) && ((PIN) <= 3))
+
+/* Check if a pin is locked (PD7, PF0) and needs its changes committed through GPIOCR */
+#define PORT_IS_LOCKED_PIN(PORT, PIN) ((((PORT) == 3) && ((PIN) == 7)) || (((PORT) == 5) && ((PIN) == 0)))
+
+/* Mask of the locked pins of a port (PD7, PF0) */
+#define PORT_LOCKED_PINS_MASK(PORT) (((PORT) == 3) ? (uint32)0x80 : ((PORT) == 5) ? (uint32)0x01 : (uint32)0)
+
+/* Check if a pin mode is one of the alternative function modes */
+#define PORT_IS_ALT_MODE(MODE) (((MODE) != PORT_PIN_MODE_DIO) && ((MODE) != PORT_PIN_MODE_ADC))
+
+/* GPIOPCTL PMCx value of a pin mode: ALT1 .. ALT9 have the same value as their encoding, DIO and ADC use 0 */
+#define PORT_MODE_TO_PMC(MODE) (((MODE) == PORT_PIN_MODE_ALT14) ? (uint32)14 : \
+                                ((MODE) == PORT_PIN_MODE_ALT15) ? (uint32)15 : \
+                                PORT_IS_ALT_MODE(MODE) ? (uint32)(MODE) : (uint32)0)
+
 /* GPIO Registers offset addresses */
 #define PORT_DATA_REG_OFFSET 0x3FC
 #define PORT_DIR_REG_OFFSET 0x400
@@ -75,6 +110,19 @@
 #define PORT_COMMIT_REG_OFFSET 0x524
 #define PORT_ANALOG_MODE_SEL_REG_OFFSET 0x528
 #define PORT_CTL_REG_OFFSET 0x52C
+#define PORT_INT_SENSE_REG_OFFSET 0x404
+#define PORT_INT_BOTH_EDGES_REG_OFFSET 0x408
+#define PORT_INT_EVENT_REG_OFFSET 0x40C
+#define PORT_INT_MASK_REG_OFFSET 0x410
+#define PORT_MASKED_INT_STATUS_REG_OFFSET 0x418
+#define PORT_INT_CLEAR_REG_OFFSET 0x41C
+
+/* Interrupt number of the GPIO interrupt of each port in the NVIC (PORTA .. PORTE --> 0 .. 4, PORTF --> 30) */
+#define PORT_IRQ_NUMBER(PORT) (((PORT) == 5) ? 30U : (uint32)(PORT))
+
+/* NVIC Interrupt Priority registers, 4 interrupts of 8 bits per register with the priority in the upper 3 bits */
+#define PORT_NVIC_PRI_BASE_ADDRESS 0xE000E400
+#define PORT_NVIC_PRIORITY_BITS_POS 5U
 
 /* AUTOSAR Version 4.0.3 */
 #define PORT_AR_RELEASE_MAJOR_VERSION (4U)
@@ -122,6 +170,18 @@
 /* Service ID for Port_SetPinMode API */
 #define PORT_SET_PIN_MODE_SID (uint8)0x04
 
+/* Service ID for Port_GetInitStats API (Not exist in AUTOSAR 4.0.3 PORT SWS Document) */
+#define PORT_GET_INIT_STATS_SID (uint8)0x10
+
+/* Service ID for Port_SetPinsModeMasked API (Not exist in AUTOSAR 4.0.3 PORT SWS Document) */
+#define PORT_SET_PINS_MODE_MASKED_SID (uint8)0x11
+
+/* Service ID for Port_GetDirectionDrift API (Not exist in AUTOSAR 4.0.3 PORT SWS Document) */
+#define PORT_GET_DIRECTION_DRIFT_SID (uint8)0x12
+
+/* Service ID for Port_SetPinEdgeNotification API (Not exist in AUTOSAR 4.0.3 PORT SWS Document) */
+#define PORT_SET_PIN_EDGE_NOTIFICATION_SID (uint8)0x13
+
 /*******************************************************************************
  *                              DET Error Codes                                *
  *******************************************************************************/
@@ -147,6 +207,9 @@
 /* DET code to report API service called with NULL pointer */
 #define PORT_E_PARAM_POINTER (uint8)0x10
 
+/* DET code to report API Port_SetPinEdgeNotification service called with an invalid edge (Not exist in AUTOSAR 4.0.3 PORT SWS Document) */
+#define PORT_E_PARAM_EDGE (uint8)0x11
+
 /*******************************************************************************
  *                              Module Data Types                              *
  *******************************************************************************/
@@ -228,21 +291,72 @@ typedef enum
 
 
 
+#if (PORT_PACKED_CHANNELS == STD_ON)
 /**
- * @brief Structure to configure each individual PIN.
+ * @brief Packed configuration of each individual PIN.
+ * 
+ * The configuration of a pin is packed in 16 bits, use the PORT_CHANNEL_xxx
+ * macros to build and to read it:
+ * - port_num (bits 0..2): The port to which the pin belongs. Possible values are 0, 1, 2, 3, 4, or 5.
+ * - pin_num (bits 3..5): The number of the pin in the port.
+ * - direction (bit 6): The direction of the pin. Possible values are INPUT or OUTPUT.
+ * - resistor (bits 7..8): The internal resistor of the pin. Possible values are OFF, PULL_UP, or PULL_DOWN.
+ * - initial_value (bit 9): The initial value of the pin. Possible values are STD_HIGH or STD_LOW.
+ * - initial_mode (bits 10..13): The initial mode of the pin. Possible values are ADC, DIO, ALT1, ALT2, ALT3, ALT4, ALT5, ALT6, ALT7, ALT8, ALT9, ALT14, or ALT15.
+ * - pin_dir_changeable (bit 14): Indicates whether the pin direction is changeable. Possible values are STD_ON or STD_OFF.
+ * - pin_mode_changeable (bit 15): Indicates whether the pin mode is changeable. Possible values are STD_ON or STD_OFF.
  * 
- * This structure is used to configure each individual pin.
- * 
- * The structure contains the following members:
- * - port_num: The port to which the pin belongs. Possible values are 0, 1, 2, 3, 4, or 5.
- * - pin_num: The number of the pin in the port.
- * - direction: The direction of the pin. Possible values are INPUT or OUTPUT.
- * - resistor: The internal resistor of the pin. Possible values are OFF, PULL_UP, or PULL_DOWN.
- * - initial_value: The initial value of the pin. Possible values are STD_HIGH or STD_LOW.
- * - initial_mode: The initial mode of the pin. Possible values are ADC, DIO, ALT1, ALT2, ALT3, ALT4, ALT5, ALT6, ALT7, ALT8, ALT9, ALT14, or ALT15.
- * - pin_dir_changeable: Indicates whether the pin direction is changeable. Possible values are STD_ON or STD_OFF.
- * - pin_mode_changeable: Indicates whether the pin mode is changeable. Possible values are STD_ON or STD_OFF.
+ */
+typedef uint16 Port_ConfigChannel;
+
+/* Position and width of each field in Port_ConfigChannel */
+#define PORT_CHANNEL_PORT_NUM_SHIFT        (0U)
+#define PORT_CHANNEL_PORT_NUM_MASK         (0x7U)
+#define PORT_CHANNEL_PIN_NUM_SHIFT         (3U)
+#define PORT_CHANNEL_PIN_NUM_MASK          (0x7U)
+#define PORT_CHANNEL_DIRECTION_SHIFT       (6U)
+#define PORT_CHANNEL_DIRECTION_MASK        (0x1U)
+#define PORT_CHANNEL_RESISTOR_SHIFT        (7U)
+#define PORT_CHANNEL_RESISTOR_MASK         (0x3U)
+#define PORT_CHANNEL_INITIAL_VALUE_SHIFT   (9U)
+#define PORT_CHANNEL_INITIAL_VALUE_MASK    (0x1U)
+#define PORT_CHANNEL_INITIAL_MODE_SHIFT    (10U)
+#define PORT_CHANNEL_INITIAL_MODE_MASK     (0xFU)
+#define PORT_CHANNEL_DIR_CHANGEABLE_SHIFT  (14U)
+#define PORT_CHANNEL_DIR_CHANGEABLE_MASK   (0x1U)
+#define PORT_CHANNEL_MODE_CHANGEABLE_SHIFT (15U)
+#define PORT_CHANNEL_MODE_CHANGEABLE_MASK  (0x1U)
+
+/* Build the packed configuration of a pin (constant expression, usable in the configuration initializers) */
+#define PORT_CHANNEL(PORT, PIN, DIR, RES, VALUE, MODE, DIR_CHG, MODE_CHG) \
+    ((Port_ConfigChannel)((((uint16)(PORT) & PORT_CHANNEL_PORT_NUM_MASK) << PORT_CHANNEL_PORT_NUM_SHIFT) | \
+                          (((uint16)(PIN) & PORT_CHANNEL_PIN_NUM_MASK) << PORT_CHANNEL_PIN_NUM_SHIFT) | \
+                          (((uint16)(DIR) & PORT_CHANNEL_DIRECTION_MASK) << PORT_CHANNEL_DIRECTION_SHIFT) | \
+                          (((uint16)(RES) & PORT_CHANNEL_RESISTOR_MASK) << PORT_CHANNEL_RESISTOR_SHIFT) | \
+                          (((uint16)(VALUE) & PORT_CHANNEL_INITIAL_VALUE_MASK) << PORT_CHANNEL_INITIAL_VALUE_SHIFT) | \
+                          (((uint16)(MODE) & PORT_CHANNEL_INITIAL_MODE_MASK) << PORT_CHANNEL_INITIAL_MODE_SHIFT) | \
+                          (((uint16)(DIR_CHG) & PORT_CHANNEL_DIR_CHANGEABLE_MASK) << PORT_CHANNEL_DIR_CHANGEABLE_SHIFT) | \
+                          (((uint16)(MODE_CHG) & PORT_CHANNEL_MODE_CHANGEABLE_MASK) << PORT_CHANNEL_MODE_CHANGEABLE_SHIFT)))
+
+/* Read one field of the packed configuration of a pin */
+#define PORT_CHANNEL_FIELD(CHANNEL, FIELD) \
+    (((uint16)(CHANNEL) >> PORT_CHANNEL_##FIELD##_SHIFT) & PORT_CHANNEL_##FIELD##_MASK)
+
+#define PORT_CHANNEL_PORT_NUM(CHANNEL)        ((uint8)PORT_CHANNEL_FIELD(CHANNEL, PORT_NUM))
+#define PORT_CHANNEL_PIN_NUM(CHANNEL)         ((uint8)PORT_CHANNEL_FIELD(CHANNEL, PIN_NUM))
+#define PORT_CHANNEL_DIRECTION(CHANNEL)       ((Port_PinDirection)PORT_CHANNEL_FIELD(CHANNEL, DIRECTION))
+#define PORT_CHANNEL_RESISTOR(CHANNEL)        ((Port_InternalResistor)PORT_CHANNEL_FIELD(CHANNEL, RESISTOR))
+#define PORT_CHANNEL_INITIAL_VALUE(CHANNEL)   ((uint8)PORT_CHANNEL_FIELD(CHANNEL, INITIAL_VALUE))
+#define PORT_CHANNEL_INITIAL_MODE(CHANNEL)    ((Port_PinInitialMode)PORT_CHANNEL_FIELD(CHANNEL, INITIAL_MODE))
+#define PORT_CHANNEL_DIR_CHANGEABLE(CHANNEL)  ((uint8)PORT_CHANNEL_FIELD(CHANNEL, DIR_CHANGEABLE))
+#define PORT_CHANNEL_MODE_CHANGEABLE(CHANNEL) ((uint8)PORT_CHANNEL_FIELD(CHANNEL, MODE_CHANGEABLE))
+
+#else
+/**
+ * @brief Configuration of each individual PIN, one member per field (layout before the packing).
  * 
+ * Each entry takes 24 bytes with the enums sized as ints and the padding, but a field is
+ * read with a single load. Built and read with the same PORT_CHANNEL_xxx macros.
  */
 typedef struct
 {
@@ -256,8 +370,48 @@ typedef struct
   uint8 pin_mode_changeable;
 } Port_ConfigChannel;
 
+/* Build the configuration of a pin (initializer of one entry of the pins configuration) */
+#define PORT_CHANNEL(PORT, PIN, DIR, RES, VALUE, MODE, DIR_CHG, MODE_CHG) \
+    {(uint8)(PORT), (uint8)(PIN), (DIR), (RES), (uint8)(VALUE), (MODE), (uint8)(DIR_CHG), (uint8)(MODE_CHG)}
+
+#define PORT_CHANNEL_PORT_NUM(CHANNEL)        ((CHANNEL).port_num)
+#define PORT_CHANNEL_PIN_NUM(CHANNEL)         ((CHANNEL).pin_num)
+#define PORT_CHANNEL_DIRECTION(CHANNEL)       ((CHANNEL).direction)
+#define PORT_CHANNEL_RESISTOR(CHANNEL)        ((CHANNEL).resistor)
+#define PORT_CHANNEL_INITIAL_VALUE(CHANNEL)   ((CHANNEL).initial_value)
+#define PORT_CHANNEL_INITIAL_MODE(CHANNEL)    ((CHANNEL).initial_mode)
+#define PORT_CHANNEL_DIR_CHANGEABLE(CHANNEL)  ((CHANNEL).pin_dir_changeable)
+#define PORT_CHANNEL_MODE_CHANGEABLE(CHANNEL) ((CHANNEL).pin_mode_changeable)
+#endif
+
+
 
 
+/**
+ * @brief Register values of one GPIO port aggregated from the pins configuration.
+ *
+ * Port_Init builds one image per port then writes each register of the port once:
+ * - pins_mask: the pins of the port configured by Port_Init (only these bits are changed).
+ * - commit_mask: the locked pins (PD7, PF0) that have to be committed through GPIOCR.
+ * - dir, den, afsel, amsel, pur, pdr, data: register values on the configured pins.
+ * - pctl_mask, pctl: the PMCx nibbles of the configured pins and their values.
+ * - refresh_mask: the pins with unchangeable direction, kept at dir by Port_RefreshPortDirection.
+ */
+typedef struct
+{
+  uint32 pins_mask;
+  uint32 commit_mask;
+  uint32 dir;
+  uint32 den;
+  uint32 afsel;
+  uint32 amsel;
+  uint32 pur;
+  uint32 pdr;
+  uint32 data;
+  uint32 pctl_mask;
+  uint32 pctl;
+  uint32 refresh_mask;
+} Port_RegisterImageType;
 
 /**
  * @brief
@@ -267,14 +421,78 @@ typedef struct
  * The structure contains the following member:
  * 
  * - Channels: Array of structures containing the configuration of the pins.
+ * - Images: Register images of each port computed at build time from the same
+ *   pins list (only when PORT_PRECOMPUTED_REGISTER_IMAGES is STD_ON).
  * 
  * 
  */
 typedef struct
 {
   Port_ConfigChannel Channels[PORT_CONFIGURED_PINS];
+#if (PORT_PRECOMPUTED_REGISTER_IMAGES == STD_ON)
+  Port_RegisterImageType Images[PORT_NUMBER_OF_PORTS];
+#endif
 } Port_ConfigType;
 
+#if (PORT_SET_PIN_DIRECTION_API == STD_ON)
+/* Description: Pins found with a wrong direction by the last Port_RefreshPortDirection call,
+ *              DriftMask[port] has bit n set if pin n of the port had drifted */
+typedef struct
+{
+  uint8 DriftMask[PORT_NUMBER_OF_PORTS];
+} Port_DirectionDriftType;
+#endif
+
+#if (PORT_PIN_EDGE_NOTIFICATION_API == STD_ON)
+/* Description: Edges of a pin that trigger its notification */
+typedef enum
+{
+  PORT_PIN_EDGE_NONE,    /* The pin interrupt is disabled */
+  PORT_PIN_EDGE_FALLING,
+  PORT_PIN_EDGE_RISING,
+  PORT_PIN_EDGE_BOTH
+} Port_PinEdgeType;
+
+/* Description: Notification called from the GPIO interrupt of the port on an edge of the pin */
+typedef void (*Port_PinNotificationType)(void);
+#endif
+
+#if (PORT_INIT_INSTRUMENTATION == STD_ON)
+/* Description: Registers whose accesses are recorded by the Port_Init statistics */
+typedef enum
+{
+  PORT_STATS_DATA,
+  PORT_STATS_DIR,
+  PORT_STATS_AFSEL,
+  PORT_STATS_PUR,
+  PORT_STATS_PDR,
+  PORT_STATS_DEN,
+  PORT_STATS_LOCK,
+  PORT_STATS_CR,
+  PORT_STATS_AMSEL,
+  PORT_STATS_PCTL,
+  PORT_STATS_RCGCGPIO,
+  PORT_STATS_PRGPIO,
+  PORT_STATS_GPIOHBCTL,
+  PORT_STATS_REGS_NUMBER
+} Port_StatsRegType;
+
+/**
+ * @brief Register access statistics of the last Port_Init call.
+ *
+ * - ReadCount: number of reads of each register (indexed by Port_StatsRegType).
+ * - WriteCount: number of writes of each register (indexed by Port_StatsRegType).
+ * - EstimatedBusCycles: total bus cycles estimated from the counters using
+ *   PORT_REG_READ_BUS_CYCLES and PORT_REG_WRITE_BUS_CYCLES.
+ */
+typedef struct
+{
+  uint16 ReadCount[PORT_STATS_REGS_NUMBER];
+  uint16 WriteCount[PORT_STATS_REGS_NUMBER];
+  uint32 EstimatedBusCycles;
+} Port_InitStatsType;
+#endif
+
 /*******************************************************************************
  *                      Function Prototypes                                    *
  *******************************************************************************/
@@ -310,11 +528,12 @@ Service ID[hex]: 0x00
  * @details 
  * The function performs the following operations:
  * - Checks for a valid configuration pointer.
- * - Iterates through all configured pins and sets their properties:
- *   - Enables the clock for the required port.
- *   - Sets the pin as a digital GPIO or analog pin.
- *   - Configures the pin's direction and internal resistor type.
- *   - Provides an initial output value for the pin.
+ * - Aggregates all configured pins into one register image per port.
+ * - Enables the clock of all the used ports with a single RCGCGPIO write.
+ * - Writes each register of each used port once:
+ *   - Sets the pins as digital GPIO, analog or alternative function pins.
+ *   - Configures the pins' internal resistor type.
+ *   - Provides the initial output value of the pins then their direction.
  *
  * Reentrancy: Reentrant
  * 
@@ -382,6 +601,23 @@ void Port_SetPinDirection(Port_PinType Pin, Port_PinDirection Direction);
  * @endcode
  * 
  */
+
+/**
+ * @fn void Port_SetPinDirection_Fast(Port_PinType Pin, Port_PinDirection Direction)
+ * @brief
+ * 
+ * Unchecked variant of Port_SetPinDirection for prevalidated call sites.
+ * 
+ * The caller must guarantee the module is initialized, the pin ID is valid
+ * and the pin direction is changeable, no error is reported.
+ * 
+ * @param[in] Pin - Port Pin ID number
+ * 
+ * @param[in] Direction - Port Pin Direction
+ * 
+ * @return void
+ */
+void Port_SetPinDirection_Fast(Port_PinType Pin, Port_PinDirection Direction);
 #endif
 
 /************************************************************************************
@@ -401,7 +637,9 @@ void Port_SetPinDirection(Port_PinType Pin, Port_PinDirection Direction);
  * @fn void Port_RefreshPortDirection(void)
  * @brief 
  * 
- * this function refreshes the port direction.
+ * this function refreshes the port direction of the pins whose direction is
+ * not changeable: each used port is read once and written only if a pin has
+ * drifted from its configured direction.
  * 
  * Reentrancy: reentrant
  * 
@@ -431,6 +669,19 @@ void Port_RefreshPortDirection(void);
  * @endcode
  * 
  */
+
+/************************************************************************************
+ * Service Name: Port_GetDirectionDrift
+ * Sync/Async: Synchronous
+ * Service ID[hex]: 0x12 (Not exist in AUTOSAR 4.0.3 PORT SWS Document)
+ * Reentrancy: non reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): DriftPtr - Pointer to where to store the drifted pins of each port.
+ * Return value: None
+ * Description: Function to get the pins corrected by the last Port_RefreshPortDirection call.
+ * ************************************************************************************/
+void Port_GetDirectionDrift(Port_DirectionDriftType *DriftPtr);
 #endif
 
 /************************************************************************************
@@ -497,7 +748,8 @@ void Port_GetVersionInfo(Std_VersionInfoType *versioninfo);
  * @fn void Port_SetPinMode(Port_PinType Pin, Port_PinModeType Mode)
  * @brief
  * 
- * this function sets the mode of the port pin.
+ * this function sets the mode of the port pin: AFSEL, AMSEL, DEN and the PMCx
+ * nibble of GPIOPCTL, committing the change through GPIOCR for PD7 and PF0.
  * 
  * Reentrancy: reentrant
  * 
@@ -508,6 +760,7 @@ void Port_GetVersionInfo(Std_VersionInfoType *versioninfo);
  * Errors:
  * - Reports an error if the module is not initialized.
  * - Reports an error if the pin ID is invalid.
+ * - Reports an error if the mode is invalid.
  * - Reports an error if the pin mode is unchangeable.
  * 
  * @param[in] Pin - Port Pin ID number
@@ -523,6 +776,109 @@ void Port_SetPinMode(Port_PinType Pin, Port_PinModeType Mode);
  * 
  */
 
+/**
+ * @fn void Port_SetPinMode_Fast(Port_PinType Pin, Port_PinModeType Mode)
+ * @brief
+ * 
+ * Unchecked variant of Port_SetPinMode for prevalidated call sites.
+ * 
+ * The caller must guarantee the module is initialized, the pin ID is valid
+ * and the pin mode is changeable, no error is reported.
+ * 
+ * @param[in] Pin - Port Pin ID number
+ * 
+ * @param[in] Mode - New Port Pin mode to be set on port pin.
+ * 
+ * @return void
+ */
+void Port_SetPinMode_Fast(Port_PinType Pin, Port_PinModeType Mode);
+
+#if (PORT_SET_PINS_MODE_MASKED_API == STD_ON)
+/**
+ * @fn void Port_SetPinsModeMasked(Port_PortType Port, uint8 PinsMask, Port_PinModeType Mode, Port_PinDirection Direction)
+ * @brief
+ * 
+ * this function sets the mode and the direction of several pins of one port,
+ * each GPIO register of the port is written once for all the pins.
+ * 
+ * Reentrancy: reentrant
+ * 
+ * Sync/Async: Synchronous
+ * 
+ * Service ID: 0x11 (Not exist in AUTOSAR 4.0.3 PORT SWS Document)
+ * 
+ * Errors:
+ * - Reports an error if the module is not initialized.
+ * - Reports an error if the port is invalid or a pin of the mask is not configured.
+ * - Reports an error if the mode is invalid.
+ * - Reports an error if the direction or the mode of a pin of the mask is unchangeable.
+ * 
+ * @param[in] Port - Port ID number
+ * 
+ * @param[in] PinsMask - Pins of the port to be changed (bit n for pin n)
+ * 
+ * @param[in] Mode - New mode of the pins.
+ * 
+ * @param[in] Direction - New direction of the pins.
+ * 
+ * @return void
+ */
+void Port_SetPinsModeMasked(Port_PortType Port, uint8 PinsMask, Port_PinModeType Mode, Port_PinDirection Direction);
+
+/**
+ * @fn void Port_SetPinsModeMasked_Fast(Port_PortType Port, uint8 PinsMask, Port_PinModeType Mode, Port_PinDirection Direction)
+ * @brief
+ * 
+ * Unchecked variant of Port_SetPinsModeMasked for prevalidated call sites.
+ * 
+ * The caller must guarantee the module is initialized, the pins of the mask are
+ * configured and their mode and direction are changeable, no error is reported.
+ * 
+ * @return void
+ */
+void Port_SetPinsModeMasked_Fast(Port_PortType Port, uint8 PinsMask, Port_PinModeType Mode, Port_PinDirection Direction);
+#endif
+
+#if (PORT_PIN_EDGE_NOTIFICATION_API == STD_ON)
+/************************************************************************************
+ * Service Name: Port_SetPinEdgeNotification
+ * Sync/Async: Synchronous
+ * Service ID[hex]: 0x13 (Not exist in AUTOSAR 4.0.3 PORT SWS Document)
+ * Reentrancy: non reentrant
+ * Parameters (in): Pin - Port Pin ID number
+ *                  Edge - Edges triggering the notification, PORT_PIN_EDGE_NONE to disable the pin interrupt
+ *                  Notification - Function called from the GPIO interrupt on each edge of the pin
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function to configure the edge interrupt of an input pin (GPIOIS/GPIOIBE/GPIOIEV/GPIOIM)
+ *              and enable the GPIO interrupt of its port in the NVIC.
+ * ************************************************************************************/
+void Port_SetPinEdgeNotification(Port_PinType Pin, Port_PinEdgeType Edge, Port_PinNotificationType Notification);
+
+/* Description: GPIO interrupt handlers, installed in the vector table */
+void GPIOPortA_Handler(void);
+void GPIOPortB_Handler(void);
+void GPIOPortC_Handler(void);
+void GPIOPortD_Handler(void);
+void GPIOPortE_Handler(void);
+void GPIOPortF_Handler(void);
+#endif
+
+/************************************************************************************
+ * Service Name: Port_GetInitStats
+ * Sync/Async: Synchronous
+ * Reentrancy: non reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): StatsPtr - Pointer to where to store the register access statistics of the last Port_Init call.
+ * Return value: None
+ * Description: Function to get the register read/write counts and the estimated bus cycles of the last Port_Init call.
+ * ************************************************************************************/
+
+#if (PORT_INIT_INSTRUMENTATION == STD_ON)
+void Port_GetInitStats(Port_InitStatsType *StatsPtr);
+#endif
 
 extern const Port_ConfigType Port_Configuration;
 
@@ -50,19 +50,78 @@
 #define PORT_VERSION_INFO_API            (STD_ON)
 
 /* Number of the configured Port Pins */
-#define PORT_CONFIGURED_PINS            (2U)
+#ifndef PORT_CONFIGURED_PINS
+#define PORT_CONFIGURED_PINS            (4U)
+#endif
 
 /*set pin direction api*/
 #define PORT_SET_PIN_DIRECTION_API       (STD_ON)
 
+/*
+ * Ports accessed through the AHB aperture instead of the legacy APB one (bit n for port n, 0 --> PORTA .. 5 --> PORTF).
+ * Port_Init enables them in GPIOHBCTL, DIO_AHB_PORTS_MASK in Dio_Cfg.h must have the same value.
+ */
+#ifndef PORT_AHB_PORTS_MASK
+#define PORT_AHB_PORTS_MASK              (0x20U) /* PORT F */
+#endif
+
+/* precompile option for the pin edge interrupts API (Port_SetPinEdgeNotification) and the GPIO interrupt handlers */
+#define PORT_PIN_EDGE_NOTIFICATION_API   (STD_ON)
+
+/*
+ * Priority of the GPIO interrupts (0 is the highest), below the SysTick one (3) so an edge burst never delays
+ * the tick and above the PendSV one (7) of the preemptive Os so a task activation completes before the switch
+ */
+#define PORT_GPIO_INTERRUPT_PRIORITY     (5U)
+
+/* precompile option for the multi-pin mode/direction API (Port_SetPinsModeMasked) */
+#define PORT_SET_PINS_MODE_MASKED_API    (STD_ON)
+
+/*
+ * precompile option for the register images used by Port_Init:
+ * STD_ON  --> the images are computed at build time in Port_PBcfg.c and Port_Init only writes them
+ * STD_OFF --> Port_Init computes the images from the pins configuration at every boot
+ */
+#ifndef PORT_PRECOMPUTED_REGISTER_IMAGES
+#define PORT_PRECOMPUTED_REGISTER_IMAGES (STD_ON)
+#endif
+
+/*
+ * precompile option for the layout of the pins configuration:
+ * STD_ON  --> each pin is packed in a uint16 (2 bytes per pin), a field read is a shift and a mask
+ * STD_OFF --> each pin is a struct with one member per field (24 bytes per pin), a field read is a load
+ */
+#ifndef PORT_PACKED_CHANNELS
+#define PORT_PACKED_CHANNELS             (STD_ON)
+#endif
+
+/* precompile option for recording the register accesses of Port_Init (Port_GetInitStats API) */
+#ifndef PORT_INIT_INSTRUMENTATION
+#define PORT_INIT_INSTRUMENTATION        (STD_OFF)
+#endif
+
+/* Estimated bus cycles of one GPIO/SYSCTL register read and write, used by the Port_Init statistics */
+#define PORT_REG_READ_BUS_CYCLES         (2U)
+#define PORT_REG_WRITE_BUS_CYCLES        (1U)
+
 /* Port Pin ID's */
 
 #define PortConf_LED1_PIN_NUM           (Port_PinType)1
 #define PortConf_SW1_PIN_NUM            (Port_PinType)4
+#define PortConf_LED2_PIN_NUM           (Port_PinType)2
+#define PortConf_LED3_PIN_NUM           (Port_PinType)3
+
+/* Index of the pins in the pins configuration (Port_PinType of the Port APIs) */
+#define PortConf_LED1_PIN_ID_INDEX      (Port_PinType)0
+#define PortConf_SW1_PIN_ID_INDEX       (Port_PinType)1
+#define PortConf_LED2_PIN_ID_INDEX      (Port_PinType)2
+#define PortConf_LED3_PIN_ID_INDEX      (Port_PinType)3
 
 /* Port ID */
 #define PortConf_LED1_PORT_NUM          (Port_PortType)5 /* PORT F */
 #define PortConf_SW1_PORT_NUM           (Port_PortType)5 /* PORT F */
+#define PortConf_LED2_PORT_NUM          (Port_PortType)5 /* PORT F */
+#define PortConf_LED3_PORT_NUM          (Port_PortType)5 /* PORT F */
 
 
 #endif
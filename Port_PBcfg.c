@@ -53,35 +53,88 @@
 
 
 
+/*
+ * List of the configured pins, each entry is:
+ * PIN(ARG, port, pin, direction, resistor, initial value, initial mode, direction changeable, mode changeable)
+ * The list is expanded once into the pins configuration and once per port into the
+ * register images, so both are always generated from the same data.
+ * A build can provide its own list (with PORT_CONFIGURED_PINS) to check the images of other configurations.
+ */
+#ifndef PORT_CONFIGURED_PINS_LIST
+#define PORT_CONFIGURED_PINS_LIST(PIN, ARG) \
+    PIN(ARG, PortConf_LED1_PORT_NUM, PortConf_LED1_PIN_NUM, OUTPUT, OFF,     STD_HIGH, PORT_PIN_MODE_DIO, STD_ON, STD_ON) \
+    PIN(ARG, PortConf_SW1_PORT_NUM,  PortConf_SW1_PIN_NUM,  INPUT,  PULL_UP, STD_LOW,  PORT_PIN_MODE_DIO, STD_ON, STD_ON) \
+    PIN(ARG, PortConf_LED2_PORT_NUM, PortConf_LED2_PIN_NUM, OUTPUT, OFF,     STD_LOW,  PORT_PIN_MODE_DIO, STD_ON, STD_ON) \
+    PIN(ARG, PortConf_LED3_PORT_NUM, PortConf_LED3_PIN_NUM, OUTPUT, OFF,     STD_LOW,  PORT_PIN_MODE_DIO, STD_ON, STD_ON)
+#endif
+
+/* Pins configuration entry of one pin */
+#define PORT_PIN_CHANNEL(ARG, PORT, PIN, DIR, RES, VALUE, MODE, DIR_CHG, MODE_CHG) \
+    PORT_CHANNEL(PORT, PIN, DIR, RES, VALUE, MODE, DIR_CHG, MODE_CHG),
+
+#if (PORT_PRECOMPUTED_REGISTER_IMAGES == STD_ON)
+/* Check if a pin belongs to the register image of port ARG (JTAG pins are never part of an image) */
+#define PORT_PIN_IN_IMAGE(ARG, PORT, PIN) (((PORT) == (ARG)) && !PORT_IS_JTAG_PIN(PORT, PIN))
+
+/* Bit of a pin in a register image when COND is true, 0 otherwise */
+#define PORT_PIN_BIT(ARG, PORT, PIN, COND) \
+    | ((PORT_PIN_IN_IMAGE(ARG, PORT, PIN) && (COND)) ? ((uint32)1 << (PIN)) : (uint32)0)
+
+/* Contribution of one pin to each register of the image of port ARG, same rules as Port_BuildRegisterImages */
+#define PORT_PIN_IMAGE_PINS(ARG, PORT, PIN, DIR, RES, VALUE, MODE, DIR_CHG, MODE_CHG)   PORT_PIN_BIT(ARG, PORT, PIN, TRUE)
+#define PORT_PIN_IMAGE_COMMIT(ARG, PORT, PIN, DIR, RES, VALUE, MODE, DIR_CHG, MODE_CHG) PORT_PIN_BIT(ARG, PORT, PIN, PORT_IS_LOCKED_PIN(PORT, PIN))
+#define PORT_PIN_IMAGE_DIR(ARG, PORT, PIN, DIR, RES, VALUE, MODE, DIR_CHG, MODE_CHG)    PORT_PIN_BIT(ARG, PORT, PIN, (DIR) == OUTPUT)
+#define PORT_PIN_IMAGE_DEN(ARG, PORT, PIN, DIR, RES, VALUE, MODE, DIR_CHG, MODE_CHG)    PORT_PIN_BIT(ARG, PORT, PIN, (MODE) != PORT_PIN_MODE_ADC)
+#define PORT_PIN_IMAGE_AFSEL(ARG, PORT, PIN, DIR, RES, VALUE, MODE, DIR_CHG, MODE_CHG)  PORT_PIN_BIT(ARG, PORT, PIN, PORT_IS_ALT_MODE(MODE))
+#define PORT_PIN_IMAGE_AMSEL(ARG, PORT, PIN, DIR, RES, VALUE, MODE, DIR_CHG, MODE_CHG)  PORT_PIN_BIT(ARG, PORT, PIN, (MODE) == PORT_PIN_MODE_ADC)
+#define PORT_PIN_IMAGE_PUR(ARG, PORT, PIN, DIR, RES, VALUE, MODE, DIR_CHG, MODE_CHG)    PORT_PIN_BIT(ARG, PORT, PIN, (RES) == PULL_UP)
+#define PORT_PIN_IMAGE_PDR(ARG, PORT, PIN, DIR, RES, VALUE, MODE, DIR_CHG, MODE_CHG)    PORT_PIN_BIT(ARG, PORT, PIN, (RES) == PULL_DOWN)
+#define PORT_PIN_IMAGE_DATA(ARG, PORT, PIN, DIR, RES, VALUE, MODE, DIR_CHG, MODE_CHG)   PORT_PIN_BIT(ARG, PORT, PIN, (VALUE) == STD_HIGH)
+#define PORT_PIN_IMAGE_PCTL_MASK(ARG, PORT, PIN, DIR, RES, VALUE, MODE, DIR_CHG, MODE_CHG) \
+    | (PORT_PIN_IN_IMAGE(ARG, PORT, PIN) ? ((uint32)0x0000000F << ((PIN) * 4)) : (uint32)0)
+#define PORT_PIN_IMAGE_PCTL(ARG, PORT, PIN, DIR, RES, VALUE, MODE, DIR_CHG, MODE_CHG) \
+    | (PORT_PIN_IN_IMAGE(ARG, PORT, PIN) ? (PORT_MODE_TO_PMC(MODE) << ((PIN) * 4)) : (uint32)0)
+#define PORT_PIN_IMAGE_REFRESH(ARG, PORT, PIN, DIR, RES, VALUE, MODE, DIR_CHG, MODE_CHG) PORT_PIN_BIT(ARG, PORT, PIN, (DIR_CHG) == STD_OFF)
+
+/* Register image of one port, every member is a constant expression evaluated by the compiler */
+#define PORT_REGISTER_IMAGE(PORT) \
+    { \
+        (uint32)0 PORT_CONFIGURED_PINS_LIST(PORT_PIN_IMAGE_PINS, PORT),      \
+        (uint32)0 PORT_CONFIGURED_PINS_LIST(PORT_PIN_IMAGE_COMMIT, PORT),    \
+        (uint32)0 PORT_CONFIGURED_PINS_LIST(PORT_PIN_IMAGE_DIR, PORT),       \
+        (uint32)0 PORT_CONFIGURED_PINS_LIST(PORT_PIN_IMAGE_DEN, PORT),       \
+        (uint32)0 PORT_CONFIGURED_PINS_LIST(PORT_PIN_IMAGE_AFSEL, PORT),     \
+        (uint32)0 PORT_CONFIGURED_PINS_LIST(PORT_PIN_IMAGE_AMSEL, PORT),     \
+        (uint32)0 PORT_CONFIGURED_PINS_LIST(PORT_PIN_IMAGE_PUR, PORT),       \
+        (uint32)0 PORT_CONFIGURED_PINS_LIST(PORT_PIN_IMAGE_PDR, PORT),       \
+        (uint32)0 PORT_CONFIGURED_PINS_LIST(PORT_PIN_IMAGE_DATA, PORT),      \
+        (uint32)0 PORT_CONFIGURED_PINS_LIST(PORT_PIN_IMAGE_PCTL_MASK, PORT), \
+        (uint32)0 PORT_CONFIGURED_PINS_LIST(PORT_PIN_IMAGE_PCTL, PORT),      \
+        (uint32)0 PORT_CONFIGURED_PINS_LIST(PORT_PIN_IMAGE_REFRESH, PORT)    \
+    }
+#endif
+
 /* Array of structure contains the configuration of the pins */
 /**
  * @brief 
  * 
  * this array of structure contains the configuration of the pins
- * 
+ * and the register images of the ports computed from it at build time
  * 
  * 
  */
-extern const Port_ConfigType Port_Configuration = {
-  
-    PortConf_LED1_PORT_NUM,
-    PortConf_LED1_PIN_NUM ,
-    OUTPUT,
-    OFF,
-    STD_HIGH,
-    PORT_PIN_MODE_DIO,
-    STD_ON,
-    STD_ON,
-  
-  
-    PortConf_SW1_PORT_NUM,
-    PortConf_SW1_PIN_NUM,
-    INPUT,
-    PULL_UP,
-    STD_LOW,
-    PORT_PIN_MODE_DIO,
-    STD_ON,
-    STD_ON,
-  
+const Port_ConfigType Port_Configuration = {
+    {
+        PORT_CONFIGURED_PINS_LIST(PORT_PIN_CHANNEL, 0)
+    },
+#if (PORT_PRECOMPUTED_REGISTER_IMAGES == STD_ON)
+    {
+        PORT_REGISTER_IMAGE(0),
+        PORT_REGISTER_IMAGE(1),
+        PORT_REGISTER_IMAGE(2),
+        PORT_REGISTER_IMAGE(3),
+        PORT_REGISTER_IMAGE(4),
+        PORT_REGISTER_IMAGE(5)
+    }
+#endif
 };
-
@@ -0,0 +1,52 @@
+ /******************************************************************************
+ *
+ * Module: Test
+ *
+ * File Name: Bench.h
+ *
+ * Description: Measurement of a code sequence on the register simulator: host
+ *              instructions executed and simulated register accesses/bus cycles.
+ *
+ * Author: Tarek Emad
+ ******************************************************************************/
+
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <stdio.h>
+#include "Std_Types.h"
+#include "Sim.h"
+
+/* Cost of one measured sequence */
+typedef struct
+{
+    uint32 Instructions; /* x86-64 instructions, only comparable between the host builds of the same code base */
+    uint32 Reads;
+    uint32 Writes;
+    uint32 Bus_Cycles;   /* Modelled cycles: SIM_APB/AHB/PPB_ACCESS_CYCLES per access */
+} Bench_ResultType;
+
+/* Reference implementations are real calls like the driver APIs they are compared with */
+#define BENCH_NOINLINE  __attribute__((noinline, noclone))
+
+/* Run STATEMENT once and store its cost in RESULT */
+#define BENCH_MEASURE(RESULT, STATEMENT) \
+    do { \
+        Sim_CountersType Bench_Counters; \
+        Sim_ResetCounters(); \
+        Sim_StartInstructionCount(); \
+        STATEMENT; \
+        (RESULT).Instructions = Sim_StopInstructionCount(); \
+        Sim_GetCounters(&Bench_Counters); \
+        (RESULT).Reads = Bench_Counters.Reads; \
+        (RESULT).Writes = Bench_Counters.Writes; \
+        (RESULT).Bus_Cycles = Bench_Counters.Bus_Cycles; \
+    } while(0)
+
+/* Print one line of a benchmark table */
+#define BENCH_PRINT(NAME, RESULT) \
+    printf("  %-40s %5lu instr %3lu reads %3lu writes %4lu bus cycles\n", (NAME), \
+           (unsigned long)(RESULT).Instructions, (unsigned long)(RESULT).Reads, \
+           (unsigned long)(RESULT).Writes, (unsigned long)(RESULT).Bus_Cycles)
+
+#endif /* BENCH_H */
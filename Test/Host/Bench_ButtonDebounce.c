@@ -0,0 +1,161 @@
+ /******************************************************************************
+ *
+ * Module: Test
+ *
+ * File Name: Bench_ButtonDebounce.c
+ *
+ * Description: Cost of debouncing a 32 input panel: the whole port debouncer against the
+ *              per-pin two counters debouncer of Button_RefreshState called for each pin.
+ *
+ * Author: Tarek Emad
+ ******************************************************************************/
+
+/* 32 inputs: all the lanes of PORTA, PORTB, PORTD and PORTE */
+#define BUTTON_DEBOUNCED_PORTS_LIST(BUTTON_PORT) \
+    BUTTON_PORT(PortA, 0U, 0xFFU) \
+    BUTTON_PORT(PortB, 1U, 0xFFU) \
+    BUTTON_PORT(PortD, 3U, 0xFFU) \
+    BUTTON_PORT(PortE, 4U, 0xFFU)
+
+#include "Button.c"
+#include "Test.h"
+#include "Bench.h"
+
+/* GPIO clock, ready and aperture registers */
+#define BENCH_RCGCGPIO          (0x400FE608U)
+#define BENCH_PRGPIO            (0x400FEA08U)
+#define BENCH_GPIOHBCTL         (0x400FE06CU)
+
+/* Offset of GPIODEN from a port base address */
+#define BENCH_GPIO_DEN_OFFSET   (0x51CU)
+
+/* Number of debounced ports and pins */
+#define BENCH_PORTS             (4U)
+#define BENCH_PINS              (BENCH_PORTS * 8U)
+
+/* Dio port and APB base address of each debounced port */
+static const uint8 Bench_Dio_Ports[BENCH_PORTS] = {0U, 1U, 3U, 4U};
+static const uint32 Bench_Port_Bases[BENCH_PORTS] = {0x40004000U, 0x40005000U, 0x40007000U, 0x40024000U};
+
+/* State of each pin of the per-pin debouncer */
+static uint8 Bench_Pin_State[BENCH_PINS];
+static uint8 Bench_Pressed_Count[BENCH_PINS];
+static uint8 Bench_Released_Count[BENCH_PINS];
+
+/* Reference copy of the polled Button_RefreshState for one pin, with its counters per pin */
+BENCH_NOINLINE static void Bench_RefreshPin(uint8 Pin)
+{
+    uint8 state = Dio_ReadChannelStatic(Bench_Dio_Ports[Pin / 8U], (Dio_ChannelType)(Pin % 8U));
+
+    if(state == BUTTON_PRESSED)
+    {
+        Bench_Pressed_Count[Pin]++;
+        Bench_Released_Count[Pin] = 0;
+    }
+    else
+    {
+        Bench_Released_Count[Pin]++;
+        Bench_Pressed_Count[Pin] = 0;
+    }
+
+    if(Bench_Pressed_Count[Pin] == BUTTON_DEBOUNCE_SAMPLES)
+    {
+        Bench_Pin_State[Pin] = BUTTON_PRESSED;
+        Bench_Pressed_Count[Pin]  = 0;
+        Bench_Released_Count[Pin] = 0;
+    }
+    else if(Bench_Released_Count[Pin] == BUTTON_DEBOUNCE_SAMPLES)
+    {
+        Bench_Pin_State[Pin] = BUTTON_RELEASED;
+        Bench_Released_Count[Pin] = 0;
+        Bench_Pressed_Count[Pin]  = 0;
+    }
+}
+
+/* One sample of the panel with the per-pin debouncer */
+BENCH_NOINLINE static void Bench_RefreshPins(uint8 Pins)
+{
+    uint8 Pin;
+
+    for(Pin = 0; Pin < Pins; Pin++)
+    {
+        Bench_RefreshPin(Pin);
+    }
+}
+
+/* Enable the ports with all their pins digital inputs, every button pressed */
+static void Bench_Reset(void)
+{
+    uint8 Port;
+    uint8 Pin;
+    uint32 Ports_Mask = 0;
+
+    Sim_Reset();
+    for(Pin = 0; Pin < BENCH_PINS; Pin++)
+    {
+        Bench_Pin_State[Pin] = BUTTON_RELEASED;
+        Bench_Pressed_Count[Pin]  = 0;
+        Bench_Released_Count[Pin] = 0;
+    }
+    for(Port = 0; Port < BENCH_PORTS; Port++)
+    {
+        Ports_Mask |= (1U << Bench_Dio_Ports[Port]);
+    }
+    Sim_Poke(BENCH_RCGCGPIO, Ports_Mask);
+    Sim_Poke(BENCH_PRGPIO, Ports_Mask);
+    Sim_Poke(BENCH_GPIOHBCTL, DIO_AHB_PORTS_MASK);
+    for(Port = 0; Port < BENCH_PORTS; Port++)
+    {
+        Sim_Poke(Bench_Port_Bases[Port] + BENCH_GPIO_DEN_OFFSET, 0xFFU);
+        Sim_DriveInputs(Bench_Dio_Ports[Port], 0xFFU, (uint8)~BUTTON_RELEASED_LEVELS);
+    }
+}
+
+/*
+ * One sample of the 32 inputs: one GPIODATA read per port instead of one per pin, and the
+ * same pressed state once BUTTON_DEBOUNCE_SAMPLES samples are taken by both debouncers
+ */
+static void Bench_Panel(void)
+{
+    Bench_ResultType Per_Pin, Per_Port;
+    uint8 Sample;
+    uint8 Port;
+    uint8 Pin;
+
+    Bench_Reset();
+    for(Sample = 1U; Sample < BUTTON_DEBOUNCE_SAMPLES; Sample++)
+    {
+        Bench_RefreshPins(BENCH_PINS);
+        Button_RefreshPorts();
+    }
+    BENCH_MEASURE(Per_Pin, Bench_RefreshPins(BENCH_PINS));
+    BENCH_MEASURE(Per_Port, Button_RefreshPorts());
+
+    printf("Debounce of %u inputs on %u ports, one sample\n", BENCH_PINS, BENCH_PORTS);
+    BENCH_PRINT("per pin (Button_RefreshState x32)", Per_Pin);
+    BENCH_PRINT("per port (Button_RefreshPorts)", Per_Port);
+
+    TEST_CHECK_EQUAL(BENCH_PINS, Per_Pin.Reads);
+    TEST_CHECK_EQUAL(BENCH_PORTS, Per_Port.Reads);
+    TEST_CHECK_EQUAL(0U, Per_Pin.Writes + Per_Port.Writes);
+    TEST_CHECK_EQUAL(8U * Per_Port.Bus_Cycles, Per_Pin.Bus_Cycles);
+
+    /* Both debouncers see every button pressed */
+    for(Port = 0; Port < BENCH_PORTS; Port++)
+    {
+        TEST_CHECK_EQUAL(0xFFU, Button_GetPortState((Button_PortIdType)Port));
+    }
+    for(Pin = 0; Pin < BENCH_PINS; Pin++)
+    {
+        TEST_CHECK_EQUAL(BUTTON_PRESSED, Bench_Pin_State[Pin]);
+    }
+}
+
+int main(void)
+{
+    Sim_Init();
+
+    TEST_RUN(Bench_Panel);
+
+    return TEST_RESULT();
+}
@@ -0,0 +1,458 @@
+ /******************************************************************************
+ *
+ * Module: Test
+ *
+ * File Name: Bench_Dio.c
+ *
+ * Description: Cost of the Dio APIs on the register simulator against reference
+ *              copies of the implementations they replaced.
+ *
+ * Author: Tarek Emad
+ ******************************************************************************/
+
+#include "Test.h"
+#include "Bench.h"
+#include "Sim.h"
+#include "Det.h"
+#include "Det_Stub.h"
+#include "Dio.h"
+#include "Port.h"
+#include "tm4c123gh6pm_registers.h"
+
+/* Port and pin levels of the configured channels */
+#define BENCH_PORTF       (5U)
+#define BENCH_LED1_MASK   ((uint8)(1U << DioConf_LED1_CHANNEL_NUM))
+
+/* GPIODATA registers (APB aperture, all lanes) used by the original Dio */
+#define BENCH_PORTA_DATA_REG       (*HW_REGISTER_ADDRESS(0x400043FC))
+#define BENCH_PORTB_DATA_REG       (*HW_REGISTER_ADDRESS(0x400053FC))
+#define BENCH_PORTC_DATA_REG       (*HW_REGISTER_ADDRESS(0x400063FC))
+#define BENCH_PORTD_DATA_REG       (*HW_REGISTER_ADDRESS(0x400073FC))
+#define BENCH_PORTE_DATA_REG       (*HW_REGISTER_ADDRESS(0x400243FC))
+#define BENCH_PORTF_DATA_REG       (*HW_REGISTER_ADDRESS(0x400253FC))
+
+/* Module state of the original Dio */
+static uint8 Bench_Legacy_Status = DIO_NOT_INITIALIZED;
+
+/* Data register of a port in the original Dio: decoded from the Port Id at every call */
+BENCH_NOINLINE static volatile uint32 *Bench_LegacyDataReg(Dio_PortType PortId)
+{
+    volatile uint32 *Port_Ptr = NULL_PTR;
+
+    switch(PortId)
+    {
+        case 0:    Port_Ptr = &BENCH_PORTA_DATA_REG;
+                   break;
+        case 1:    Port_Ptr = &BENCH_PORTB_DATA_REG;
+                   break;
+        case 2:    Port_Ptr = &BENCH_PORTC_DATA_REG;
+                   break;
+        case 3:    Port_Ptr = &BENCH_PORTD_DATA_REG;
+                   break;
+        case 4:    Port_Ptr = &BENCH_PORTE_DATA_REG;
+                   break;
+        case 5:    Port_Ptr = &BENCH_PORTF_DATA_REG;
+                   break;
+    }
+    return Port_Ptr;
+}
+
+/* Reference copy of the original Dio_WriteChannel: checks, port switch and read-modify-write */
+BENCH_NOINLINE static void Bench_LegacyWriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level)
+{
+    volatile uint32 *Port_Ptr = NULL_PTR;
+    boolean error = FALSE;
+
+    if (DIO_NOT_INITIALIZED == Bench_Legacy_Status)
+    {
+        Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_WRITE_CHANNEL_SID, DIO_E_UNINIT);
+        error = TRUE;
+    }
+    if (DIO_CONFIGURED_CHANNLES <= ChannelId)
+    {
+        Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_WRITE_CHANNEL_SID, DIO_E_PARAM_INVALID_CHANNEL_ID);
+        error = TRUE;
+    }
+
+    if(FALSE == error)
+    {
+        Port_Ptr = Bench_LegacyDataReg(Dio_Configuration.Channels[ChannelId].Port_Num);
+        if(Level == STD_HIGH)
+        {
+            SET_BIT(*Port_Ptr, Dio_Configuration.Channels[ChannelId].Ch_Num);
+        }
+        else if(Level == STD_LOW)
+        {
+            CLEAR_BIT(*Port_Ptr, Dio_Configuration.Channels[ChannelId].Ch_Num);
+        }
+    }
+}
+
+/* Reference copy of the original Dio_ReadChannel */
+BENCH_NOINLINE static Dio_LevelType Bench_LegacyReadChannel(Dio_ChannelType ChannelId)
+{
+    volatile uint32 *Port_Ptr = NULL_PTR;
+    Dio_LevelType output = STD_LOW;
+    boolean error = FALSE;
+
+    if (DIO_NOT_INITIALIZED == Bench_Legacy_Status)
+    {
+        Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_READ_CHANNEL_SID, DIO_E_UNINIT);
+        error = TRUE;
+    }
+    if (DIO_CONFIGURED_CHANNLES <= ChannelId)
+    {
+        Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_READ_CHANNEL_SID, DIO_E_PARAM_INVALID_CHANNEL_ID);
+        error = TRUE;
+    }
+
+    if(FALSE == error)
+    {
+        Port_Ptr = Bench_LegacyDataReg(Dio_Configuration.Channels[ChannelId].Port_Num);
+        if(GET_BIT(*Port_Ptr, Dio_Configuration.Channels[ChannelId].Ch_Num) == STD_HIGH)
+        {
+            output = STD_HIGH;
+        }
+        else
+        {
+            output = STD_LOW;
+        }
+    }
+    return output;
+}
+
+/* Reference copy of the original Dio_FlipChannel: GET_BIT then SET_BIT/CLEAR_BIT */
+BENCH_NOINLINE static Dio_LevelType Bench_LegacyFlipChannel(Dio_ChannelType ChannelId)
+{
+    volatile uint32 *Port_Ptr = NULL_PTR;
+    Dio_LevelType output = STD_LOW;
+    boolean error = FALSE;
+
+    if (DIO_NOT_INITIALIZED == Bench_Legacy_Status)
+    {
+        Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_FLIP_CHANNEL_SID, DIO_E_UNINIT);
+        error = TRUE;
+    }
+    if (DIO_CONFIGURED_CHANNLES <= ChannelId)
+    {
+        Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_FLIP_CHANNEL_SID, DIO_E_PARAM_INVALID_CHANNEL_ID);
+        error = TRUE;
+    }
+
+    if(FALSE == error)
+    {
+        Port_Ptr = Bench_LegacyDataReg(Dio_Configuration.Channels[ChannelId].Port_Num);
+        if(GET_BIT(*Port_Ptr, Dio_Configuration.Channels[ChannelId].Ch_Num) == STD_HIGH)
+        {
+            CLEAR_BIT(*Port_Ptr, Dio_Configuration.Channels[ChannelId].Ch_Num);
+            output = STD_LOW;
+        }
+        else
+        {
+            SET_BIT(*Port_Ptr, Dio_Configuration.Channels[ChannelId].Ch_Num);
+            output = STD_HIGH;
+        }
+    }
+    return output;
+}
+
+/* Original Dio: PORTF clocked and used through its APB aperture */
+static void Bench_SetupLegacy(void)
+{
+    Sim_Reset();
+    SYSCTL_RCGCGPIO_REG |= 0x20U;
+    while((SYSCTL_PRGPIO_REG & 0x20U) == 0U);
+    GPIO_PORTF_DIR_REG = 0x0EU;
+    GPIO_PORTF_DEN_REG = 0x1EU;
+    Bench_Legacy_Status = DIO_INITIALIZED;
+}
+
+/* Current drivers: Port_Init (PORTF moved to AHB) then Dio_Init */
+static void Bench_SetupDrivers(void)
+{
+    Sim_Reset();
+    Port_Init(&Port_Configuration);
+    Dio_Init(&Dio_Configuration);
+}
+
+/* Channel read/write/flip: port switch of the original Dio against the table resolved by Dio_Init */
+static void Bench_ChannelTable(void)
+{
+    Bench_ResultType Legacy_Write, Legacy_Read, Legacy_Flip;
+    Bench_ResultType Write, Read, Flip;
+    Dio_LevelType Level;
+
+    printf("Dio channel APIs: port switch per call vs table resolved by Dio_Init\n");
+
+    Bench_SetupLegacy();
+    BENCH_MEASURE(Legacy_Write, Bench_LegacyWriteChannel(DioConf_LED1_CHANNEL_ID_INDEX, STD_HIGH));
+    TEST_CHECK_EQUAL(BENCH_LED1_MASK, Sim_GetPinLevels(BENCH_PORTF) & BENCH_LED1_MASK);
+    BENCH_MEASURE(Legacy_Read, Level = Bench_LegacyReadChannel(DioConf_LED1_CHANNEL_ID_INDEX));
+    TEST_CHECK_EQUAL(STD_HIGH, Level);
+    BENCH_MEASURE(Legacy_Flip, Level = Bench_LegacyFlipChannel(DioConf_LED1_CHANNEL_ID_INDEX));
+    TEST_CHECK_EQUAL(STD_LOW, Level);
+
+    Bench_SetupDrivers();
+    BENCH_MEASURE(Write, Dio_WriteChannel(DioConf_LED1_CHANNEL_ID_INDEX, STD_HIGH));
+    TEST_CHECK_EQUAL(BENCH_LED1_MASK, Sim_GetPinLevels(BENCH_PORTF) & BENCH_LED1_MASK);
+    BENCH_MEASURE(Read, Level = Dio_ReadChannel(DioConf_LED1_CHANNEL_ID_INDEX));
+    TEST_CHECK_EQUAL(STD_HIGH, Level);
+    BENCH_MEASURE(Flip, Level = Dio_FlipChannel(DioConf_LED1_CHANNEL_ID_INDEX));
+    TEST_CHECK_EQUAL(STD_LOW, Level);
+    TEST_CHECK_EQUAL(0U, Sim_GetPinLevels(BENCH_PORTF) & BENCH_LED1_MASK);
+
+    BENCH_PRINT("Dio_WriteChannel (switch)", Legacy_Write);
+    BENCH_PRINT("Dio_WriteChannel (table)", Write);
+    BENCH_PRINT("Dio_ReadChannel (switch)", Legacy_Read);
+    BENCH_PRINT("Dio_ReadChannel (table)", Read);
+    BENCH_PRINT("Dio_FlipChannel (switch)", Legacy_Flip);
+    BENCH_PRINT("Dio_FlipChannel (table)", Flip);
+
+    /* The instruction counts depend on the host compiler, only the bus costs are checked */
+    TEST_CHECK(Write.Bus_Cycles < Legacy_Write.Bus_Cycles);
+    TEST_CHECK(Read.Bus_Cycles < Legacy_Read.Bus_Cycles);
+    TEST_CHECK(Flip.Reads < Legacy_Flip.Reads);
+}
+
+/*
+ * Byte-wide sample: 8 channel reads against 1 Dio_ReadPort.
+ * Only two channels are configured, the 8 reads cycle through them at the cost of any channel read.
+ */
+static void Bench_ReadPort(void)
+{
+    Bench_ResultType Legacy_Reads, Reads, Port_Read;
+    Dio_PortLevelType Sample = 0U;
+    uint8 Index;
+
+    printf("Dio byte sample: 8 channel reads vs 1 port read\n");
+
+    Bench_SetupLegacy();
+    BENCH_MEASURE(Legacy_Reads,
+                  for(Index = 0U; Index < 8U; Index++)
+                  {
+                      Sample |= (Dio_PortLevelType)(Bench_LegacyReadChannel(Index % DIO_CONFIGURED_CHANNLES) << Index);
+                  });
+
+    Bench_SetupDrivers();
+    Sim_DriveInputs(BENCH_PORTF, 0x10U, 0x10U);
+    Dio_WriteChannel(DioConf_LED1_CHANNEL_ID_INDEX, STD_HIGH);
+    BENCH_MEASURE(Reads,
+                  for(Index = 0U; Index < 8U; Index++)
+                  {
+                      Sample |= (Dio_PortLevelType)(Dio_ReadChannel(Index % DIO_CONFIGURED_CHANNLES) << Index);
+                  });
+    BENCH_MEASURE(Port_Read, Sample = Dio_ReadPort(BENCH_PORTF));
+    TEST_CHECK_EQUAL(0x12U, Sample & 0x1EU);
+
+    BENCH_PRINT("8 x Dio_ReadChannel (switch)", Legacy_Reads);
+    BENCH_PRINT("8 x Dio_ReadChannel (table)", Reads);
+    BENCH_PRINT("1 x Dio_ReadPort", Port_Read);
+
+    TEST_CHECK_EQUAL(8U, Legacy_Reads.Reads);
+    TEST_CHECK_EQUAL(1U, Port_Read.Reads);
+    TEST_CHECK_EQUAL(0U, Port_Read.Writes);
+}
+
+/*
+ * 3-pin group (PF1..PF3): 3 channel writes against 1 Dio_WriteChannelGroup, then 16 group updates.
+ * Only LED1 is a configured channel, the 3 channel writes use it for the cost of any channel write.
+ */
+static void Bench_ChannelGroup(void)
+{
+    Bench_ResultType Legacy_Pins, Group_Write, Group_Read, Group_Stream;
+    const Dio_ChannelGroupType *Group_Ptr = &Dio_Configuration.Groups[DioConf_LEDS_GROUP_ID_INDEX];
+    Dio_PortLevelType Level = 0U;
+    uint8 Index;
+
+    printf("Dio 3-pin group: 3 channel writes vs 1 group write\n");
+
+    Bench_SetupLegacy();
+    BENCH_MEASURE(Legacy_Pins,
+                  for(Index = 0U; Index < 3U; Index++)
+                  {
+                      Bench_LegacyWriteChannel(DioConf_LED1_CHANNEL_ID_INDEX, STD_HIGH);
+                  });
+
+    Bench_SetupDrivers();
+    Sim_DriveInputs(BENCH_PORTF, 0x10U, 0x10U);
+    BENCH_MEASURE(Group_Write, Dio_WriteChannelGroup(Group_Ptr, 0x05U));
+    TEST_CHECK_EQUAL(0x0AU, Sim_GetPinLevels(BENCH_PORTF) & 0x0EU);
+    BENCH_MEASURE(Group_Read, Level = Dio_ReadChannelGroup(Group_Ptr));
+    TEST_CHECK_EQUAL(0x05U, Level);
+
+    /* Throughput of a 3-bit bus: every value once, the input PF4 is never written */
+    BENCH_MEASURE(Group_Stream,
+                  for(Index = 0U; Index < 16U; Index++)
+                  {
+                      Dio_WriteChannelGroup(Group_Ptr, (Dio_PortLevelType)(Index & 0x07U));
+                  });
+    TEST_CHECK_EQUAL(0x0EU, Sim_GetPinLevels(BENCH_PORTF) & 0x0EU);
+    TEST_CHECK_EQUAL(0x10U, Sim_GetPinLevels(BENCH_PORTF) & 0x10U);
+
+    BENCH_PRINT("3 x Dio_WriteChannel (switch)", Legacy_Pins);
+    BENCH_PRINT("1 x Dio_WriteChannelGroup", Group_Write);
+    BENCH_PRINT("1 x Dio_ReadChannelGroup", Group_Read);
+    BENCH_PRINT("16 x Dio_WriteChannelGroup", Group_Stream);
+
+    /* All the group pins change in the same store */
+    TEST_CHECK_EQUAL(0U, Group_Write.Reads);
+    TEST_CHECK_EQUAL(1U, Group_Write.Writes);
+    TEST_CHECK_EQUAL(16U, Group_Stream.Writes);
+    TEST_CHECK_EQUAL(0U, Group_Stream.Reads);
+}
+
+/* 20 channel updates per control cycle: per-call writes against one batch committed once */
+static void Bench_Batch(void)
+{
+    Bench_ResultType Legacy_Calls, Calls, Batch;
+    uint8 Index;
+
+    printf("Dio 20 channel updates: per-call writes vs one batch\n");
+
+    Bench_SetupLegacy();
+    BENCH_MEASURE(Legacy_Calls,
+                  for(Index = 0U; Index < 20U; Index++)
+                  {
+                      Bench_LegacyWriteChannel(Index % DIO_CONFIGURED_CHANNLES, (Dio_LevelType)((Index >> 1) & 1U));
+                  });
+
+    Bench_SetupDrivers();
+    BENCH_MEASURE(Calls,
+                  for(Index = 0U; Index < 20U; Index++)
+                  {
+                      Dio_WriteChannel(Index % DIO_CONFIGURED_CHANNLES, (Dio_LevelType)((Index >> 1) & 1U));
+                  });
+    Dio_WriteChannel(DioConf_LED1_CHANNEL_ID_INDEX, STD_LOW);
+
+    BENCH_MEASURE(Batch,
+                  Dio_BeginBatch();
+                  for(Index = 0U; Index < 20U; Index++)
+                  {
+                      Dio_BatchWriteChannel(Index % DIO_CONFIGURED_CHANNLES, (Dio_LevelType)((Index >> 1) & 1U));
+                  }
+                  Dio_CommitBatch());
+    /* The last level staged for LED1 (Index 18) is high, the other pins are untouched */
+    TEST_CHECK_EQUAL(BENCH_LED1_MASK, Sim_GetPinLevels(BENCH_PORTF) & 0x0EU);
+
+    BENCH_PRINT("20 x Dio_WriteChannel (switch)", Legacy_Calls);
+    BENCH_PRINT("20 x Dio_WriteChannel (table)", Calls);
+    BENCH_PRINT("Begin + 20 x BatchWriteChannel + Commit", Batch);
+
+    TEST_CHECK_EQUAL(40U, Legacy_Calls.Reads + Legacy_Calls.Writes);
+    TEST_CHECK_EQUAL(0U, Batch.Reads);
+    TEST_CHECK_EQUAL(1U, Batch.Writes);
+}
+
+/* LED1 write/read/flip: runtime channel table against the accessors resolved at compile time from Dio_Cfg.h */
+static void Bench_StaticAccessors(void)
+{
+    Bench_ResultType Runtime_Write, Runtime_Read, Runtime_Flip;
+    Bench_ResultType Static_Write, Static_Read, Static_Flip;
+    Dio_LevelType Level;
+
+    printf("Dio LED1 accessors: runtime table vs compile-time resolved\n");
+
+    Bench_SetupDrivers();
+    BENCH_MEASURE(Runtime_Write, Dio_WriteChannel(DioConf_LED1_CHANNEL_ID_INDEX, STD_HIGH));
+    BENCH_MEASURE(Runtime_Read, Level = Dio_ReadChannel(DioConf_LED1_CHANNEL_ID_INDEX));
+    TEST_CHECK_EQUAL(STD_HIGH, Level);
+    BENCH_MEASURE(Runtime_Flip, Level = Dio_FlipChannel(DioConf_LED1_CHANNEL_ID_INDEX));
+    TEST_CHECK_EQUAL(STD_LOW, Level);
+
+    BENCH_MEASURE(Static_Write, Dio_WriteChannel_LED1(STD_HIGH));
+    TEST_CHECK_EQUAL(BENCH_LED1_MASK, Sim_GetPinLevels(BENCH_PORTF) & 0x0EU);
+    BENCH_MEASURE(Static_Read, Level = Dio_ReadChannel_LED1());
+    TEST_CHECK_EQUAL(STD_HIGH, Level);
+    BENCH_MEASURE(Static_Flip, Level = Dio_FlipChannel_LED1());
+    TEST_CHECK_EQUAL(STD_LOW, Level);
+    TEST_CHECK_EQUAL(0U, Sim_GetPinLevels(BENCH_PORTF) & 0x0EU);
+
+    BENCH_PRINT("Dio_WriteChannel", Runtime_Write);
+    BENCH_PRINT("Dio_WriteChannel_LED1", Static_Write);
+    BENCH_PRINT("Dio_ReadChannel", Runtime_Read);
+    BENCH_PRINT("Dio_ReadChannel_LED1", Static_Read);
+    BENCH_PRINT("Dio_FlipChannel", Runtime_Flip);
+    BENCH_PRINT("Dio_FlipChannel_LED1", Static_Flip);
+
+    /* Same bus accesses, the address and the mask are constants */
+    TEST_CHECK_EQUAL(Runtime_Write.Writes, Static_Write.Writes);
+    TEST_CHECK_EQUAL(Runtime_Read.Reads, Static_Read.Reads);
+    TEST_CHECK_EQUAL(Runtime_Flip.Reads + Runtime_Flip.Writes, Static_Flip.Reads + Static_Flip.Writes);
+}
+
+/* Measure the checked API and its _Fast variant and check they do the same register accesses */
+#define BENCH_TIERS(NAME, CHECKED, FAST) \
+    do { \
+        Bench_ResultType Bench_Checked, Bench_Fast; \
+        BENCH_MEASURE(Bench_Checked, CHECKED); \
+        BENCH_MEASURE(Bench_Fast, FAST); \
+        BENCH_PRINT(NAME, Bench_Checked); \
+        BENCH_PRINT(NAME "_Fast", Bench_Fast); \
+        TEST_CHECK_EQUAL(Bench_Checked.Reads, Bench_Fast.Reads); \
+        TEST_CHECK_EQUAL(Bench_Checked.Writes, Bench_Fast.Writes); \
+    } while(0)
+
+/* Per-API cost of the validated entry points and of their unchecked _Fast variants */
+static void Bench_ApiTiers(void)
+{
+    const Dio_ChannelGroupType *Group_Ptr = &Dio_Configuration.Groups[DioConf_LEDS_GROUP_ID_INDEX];
+    Dio_PortLevelType Port_Level;
+    Dio_LevelType Level;
+
+    printf("Dio/Port APIs: checked vs _Fast\n");
+
+    Bench_SetupDrivers();
+    Det_StubReset();
+    BENCH_TIERS("Dio_WriteChannel",
+                Dio_WriteChannel(DioConf_LED1_CHANNEL_ID_INDEX, STD_HIGH),
+                Dio_WriteChannel_Fast(DioConf_LED1_CHANNEL_ID_INDEX, STD_HIGH));
+    BENCH_TIERS("Dio_ReadChannel",
+                Level = Dio_ReadChannel(DioConf_LED1_CHANNEL_ID_INDEX),
+                Level = Dio_ReadChannel_Fast(DioConf_LED1_CHANNEL_ID_INDEX));
+    TEST_CHECK_EQUAL(STD_HIGH, Level);
+    BENCH_TIERS("Dio_FlipChannel",
+                Level = Dio_FlipChannel(DioConf_LED1_CHANNEL_ID_INDEX),
+                Level = Dio_FlipChannel_Fast(DioConf_LED1_CHANNEL_ID_INDEX));
+    TEST_CHECK_EQUAL(STD_HIGH, Level);
+    BENCH_TIERS("Dio_ReadPort",
+                Port_Level = Dio_ReadPort(BENCH_PORTF),
+                Port_Level = Dio_ReadPort_Fast(BENCH_PORTF));
+    TEST_CHECK_EQUAL(BENCH_LED1_MASK, Port_Level & 0x0EU);
+    BENCH_TIERS("Dio_WritePort",
+                Dio_WritePort(BENCH_PORTF, Port_Level),
+                Dio_WritePort_Fast(BENCH_PORTF, Port_Level));
+    BENCH_TIERS("Dio_WriteChannelGroup",
+                Dio_WriteChannelGroup(Group_Ptr, 0x03U),
+                Dio_WriteChannelGroup_Fast(Group_Ptr, 0x03U));
+    BENCH_TIERS("Dio_ReadChannelGroup",
+                Port_Level = Dio_ReadChannelGroup(Group_Ptr),
+                Port_Level = Dio_ReadChannelGroup_Fast(Group_Ptr));
+    TEST_CHECK_EQUAL(0x03U, Port_Level);
+    BENCH_TIERS("Port_SetPinDirection",
+                Port_SetPinDirection(PortConf_LED1_PIN_ID_INDEX, OUTPUT),
+                Port_SetPinDirection_Fast(PortConf_LED1_PIN_ID_INDEX, OUTPUT));
+    BENCH_TIERS("Port_SetPinMode",
+                Port_SetPinMode(PortConf_LED1_PIN_ID_INDEX, PORT_PIN_MODE_DIO),
+                Port_SetPinMode_Fast(PortConf_LED1_PIN_ID_INDEX, PORT_PIN_MODE_DIO));
+    BENCH_TIERS("Port_SetPinsModeMasked",
+                Port_SetPinsModeMasked(BENCH_PORTF, 0x0EU, PORT_PIN_MODE_DIO, OUTPUT),
+                Port_SetPinsModeMasked_Fast(BENCH_PORTF, 0x0EU, PORT_PIN_MODE_DIO, OUTPUT));
+
+    /* Both tiers leave the pins in the same state and no check failed */
+    TEST_CHECK_EQUAL(0x06U, Sim_GetPinLevels(BENCH_PORTF) & 0x0EU);
+    TEST_CHECK_EQUAL(0U, Det_StubGetCount());
+}
+
+int main(void)
+{
+    Sim_Init();
+
+    TEST_RUN(Bench_ChannelTable);
+    TEST_RUN(Bench_ReadPort);
+    TEST_RUN(Bench_ChannelGroup);
+    TEST_RUN(Bench_Batch);
+    TEST_RUN(Bench_StaticAccessors);
+    TEST_RUN(Bench_ApiTiers);
+
+    return TEST_RESULT();
+}
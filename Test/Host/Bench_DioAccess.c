@@ -0,0 +1,118 @@
+ /******************************************************************************
+ *
+ * Module: Test
+ *
+ * File Name: Bench_DioAccess.c
+ *
+ * Description: Channel read/write/flip of one Dio access mode on the register
+ *              simulator. Built once per mode: bit-band alias, masked GPIODATA
+ *              alias and read-modify-write of the whole port.
+ *
+ * Author: Tarek Emad
+ ******************************************************************************/
+
+#include "Test.h"
+#include "Bench.h"
+#include "Sim.h"
+#include "Dio.h"
+#include "Port.h"
+
+#if (DIO_BITBAND_ACCESS == STD_ON)
+#define BENCH_MODE_NAME     "bit-band"
+#define BENCH_FLIP_READS    (1U)
+#elif (DIO_MASKED_DATA_ACCESS == STD_ON)
+#define BENCH_MODE_NAME     "masked alias"
+#define BENCH_FLIP_READS    (1U)
+#else
+#define BENCH_MODE_NAME     "read-modify-write"
+#define BENCH_FLIP_READS    (2U) /* GET_BIT test, then the read of the read-modify-write */
+#endif
+
+#define BENCH_PORTF         (5U)
+#define BENCH_LED1_MASK     ((uint8)(1U << DioConf_LED1_CHANNEL_NUM))
+#define BENCH_LED2_MASK     (0x04U)
+
+/* Number of reads seen by the access hook */
+static uint32 Bench_Hook_Reads;
+
+/* Interrupt setting LED2 right after the last read of the flip, before its write */
+static void Bench_PreemptAfterRead(const Sim_TraceType *Access_Ptr)
+{
+    if ((Access_Ptr->Write == FALSE) && (++Bench_Hook_Reads == BENCH_FLIP_READS))
+    {
+        Sim_Poke(0x4005D000U + ((uint32)BENCH_LED2_MASK << 2), BENCH_LED2_MASK);
+    }
+}
+
+static void Bench_Setup(void)
+{
+    Sim_Reset();
+    Port_Init(&Port_Configuration);
+    Dio_Init(&Dio_Configuration);
+}
+
+/* Cost of the channel APIs, the levels of the other pins are kept */
+static void Bench_ChannelAccess(void)
+{
+    Bench_ResultType Write, Read, Flip;
+    Dio_LevelType Level;
+
+    printf("Dio channel access: %s\n", BENCH_MODE_NAME);
+
+    Bench_Setup();
+    Sim_DriveInputs(BENCH_PORTF, 0x10U, 0x10U);
+    BENCH_MEASURE(Write, Dio_WriteChannel_Fast(DioConf_LED1_CHANNEL_ID_INDEX, STD_LOW));
+    TEST_CHECK_EQUAL(0U, Sim_GetPinLevels(BENCH_PORTF) & BENCH_LED1_MASK);
+    BENCH_MEASURE(Read, Level = Dio_ReadChannel_Fast(DioConf_SW1_CHANNEL_ID_INDEX));
+    TEST_CHECK_EQUAL(STD_HIGH, Level);
+    BENCH_MEASURE(Flip, Level = Dio_FlipChannel_Fast(DioConf_LED1_CHANNEL_ID_INDEX));
+    TEST_CHECK_EQUAL(STD_HIGH, Level);
+    TEST_CHECK_EQUAL(BENCH_LED1_MASK, Sim_GetPinLevels(BENCH_PORTF) & 0x0EU);
+
+    BENCH_PRINT("Dio_WriteChannel_Fast", Write);
+    BENCH_PRINT("Dio_ReadChannel_Fast", Read);
+    BENCH_PRINT("Dio_FlipChannel_Fast", Flip);
+
+#if (DIO_BITBAND_ACCESS == STD_ON) || (DIO_MASKED_DATA_ACCESS == STD_ON)
+    /* Single word accesses: no read before a write */
+    TEST_CHECK_EQUAL(0U, Write.Reads);
+    TEST_CHECK_EQUAL(1U, Write.Writes);
+#else
+    TEST_CHECK_EQUAL(1U, Write.Reads);
+    TEST_CHECK_EQUAL(1U, Write.Writes);
+#endif
+    TEST_CHECK_EQUAL(1U, Read.Reads);
+    TEST_CHECK_EQUAL(BENCH_FLIP_READS, Flip.Reads);
+    TEST_CHECK_EQUAL(1U, Flip.Writes);
+}
+
+/* An interrupt writing another pin of the port between the read and the write of a flip */
+static void Bench_FlipPreempted(void)
+{
+    Bench_Setup();
+    Dio_WriteChannel_Fast(DioConf_LED1_CHANNEL_ID_INDEX, STD_LOW);
+
+    Bench_Hook_Reads = 0U;
+    Sim_SetAccessHook(Bench_PreemptAfterRead);
+    (void)Dio_FlipChannel_Fast(DioConf_LED1_CHANNEL_ID_INDEX);
+    Sim_SetAccessHook(NULL_PTR);
+
+    TEST_CHECK_EQUAL(BENCH_LED1_MASK, Sim_GetPinLevels(BENCH_PORTF) & BENCH_LED1_MASK);
+#if (DIO_BITBAND_ACCESS == STD_ON) || (DIO_MASKED_DATA_ACCESS == STD_ON)
+    /* The flip only writes its own lane */
+    TEST_CHECK_EQUAL(BENCH_LED2_MASK, Sim_GetPinLevels(BENCH_PORTF) & BENCH_LED2_MASK);
+#else
+    /* The stale port value written back loses the update of the interrupt */
+    TEST_CHECK_EQUAL(0U, Sim_GetPinLevels(BENCH_PORTF) & BENCH_LED2_MASK);
+#endif
+}
+
+int main(void)
+{
+    Sim_Init();
+
+    TEST_RUN(Bench_ChannelAccess);
+    TEST_RUN(Bench_FlipPreempted);
+
+    return TEST_RESULT();
+}
@@ -0,0 +1,87 @@
+ /******************************************************************************
+ *
+ * Module: Test
+ *
+ * File Name: Bench_DioAperture.c
+ *
+ * Description: LED1 (PF1) toggled through the GPIO aperture selected by PORT_AHB_PORTS_MASK
+ *              and DIO_AHB_PORTS_MASK. Built once with PORTF on APB (0) and once on AHB
+ *              (0x20): the same accesses, SIM_APB_ACCESS_CYCLES or SIM_AHB_ACCESS_CYCLES each.
+ *
+ * Author: Tarek Emad
+ ******************************************************************************/
+
+#include "Test.h"
+#include "Bench.h"
+#include "Sim.h"
+#include "Dio.h"
+#include "Port.h"
+
+#if ((DIO_AHB_PORTS_MASK & 0x20U) != 0U)
+#define BENCH_APERTURE_NAME     "AHB"
+#define BENCH_ACCESS_CYCLES     (SIM_AHB_ACCESS_CYCLES)
+#else
+#define BENCH_APERTURE_NAME     "APB"
+#define BENCH_ACCESS_CYCLES     (SIM_APB_ACCESS_CYCLES)
+#endif
+
+#define BENCH_PORTF             (5U)
+#define BENCH_LED1_MASK         ((uint8)(1U << DioConf_LED1_CHANNEL_NUM))
+
+/* Number of toggles of a measure */
+#define BENCH_TOGGLES           (100U)
+
+BENCH_NOINLINE static void Bench_Toggle(uint32 Count)
+{
+    uint32 Toggle;
+
+    for (Toggle = 0; Toggle < Count; Toggle++)
+    {
+        (void)Dio_FlipChannel_Fast(DioConf_LED1_CHANNEL_ID_INDEX);
+    }
+}
+
+/* Accesses and modelled bus cycles of BENCH_TOGGLES flips of LED1, all of them on the selected aperture */
+static void Bench_ToggleLed(void)
+{
+    Bench_ResultType Toggles;
+    Sim_CountersType Counters;
+    uint8 Level;
+
+    Sim_Reset();
+    Port_Init(&Port_Configuration);
+    Dio_Init(&Dio_Configuration);
+    Level = Sim_GetPinLevels(BENCH_PORTF) & BENCH_LED1_MASK;
+
+    BENCH_MEASURE(Toggles, Bench_Toggle(BENCH_TOGGLES));
+    Sim_GetCounters(&Counters);
+
+    printf("LED1 (PF1) toggled %u times through the %s aperture\n", BENCH_TOGGLES, BENCH_APERTURE_NAME);
+    BENCH_PRINT("Dio_FlipChannel_Fast x100", Toggles);
+    printf("  %lu APB accesses %lu AHB accesses, %lu bus cycles per toggle\n",
+           (unsigned long)Counters.Gpio_Apb_Accesses, (unsigned long)Counters.Gpio_Ahb_Accesses,
+           (unsigned long)(Toggles.Bus_Cycles / BENCH_TOGGLES));
+
+    /* An even number of toggles leaves the LED at its level */
+    TEST_CHECK_EQUAL(Level, Sim_GetPinLevels(BENCH_PORTF) & BENCH_LED1_MASK);
+    TEST_CHECK_EQUAL(BENCH_TOGGLES, Toggles.Writes);
+    TEST_CHECK_EQUAL((Toggles.Reads + Toggles.Writes) * BENCH_ACCESS_CYCLES, Toggles.Bus_Cycles);
+#if ((DIO_AHB_PORTS_MASK & 0x20U) != 0U)
+    TEST_CHECK_EQUAL(Toggles.Reads + Toggles.Writes, Counters.Gpio_Ahb_Accesses);
+    TEST_CHECK_EQUAL(0U, Counters.Gpio_Apb_Accesses);
+#else
+    TEST_CHECK_EQUAL(Toggles.Reads + Toggles.Writes, Counters.Gpio_Apb_Accesses);
+    TEST_CHECK_EQUAL(0U, Counters.Gpio_Ahb_Accesses);
+#endif
+    TEST_CHECK_EQUAL(0U, Counters.Aperture_Violations);
+    TEST_CHECK_EQUAL(0U, Counters.Clock_Violations);
+}
+
+int main(void)
+{
+    Sim_Init();
+
+    TEST_RUN(Bench_ToggleLed);
+
+    return TEST_RESULT();
+}
@@ -0,0 +1,150 @@
+ /******************************************************************************
+ *
+ * Module: Test
+ *
+ * File Name: Bench_OsProfiler.c
+ *
+ * Description: Overhead of the task profiler against the direct task calls, and the
+ *              execution time of a task across a SysTick reload in the tickless mode.
+ *
+ * Author: Tarek Emad
+ ******************************************************************************/
+
+/* Periods of 2, 1 and 3 frames so the period after a reload differs from the running one */
+#define OS_TASKS_LIST(OS_TASK) \
+    OS_TASK(Test_Fast_Task,  60,  0, 50, STD_ON)  \
+    OS_TASK(Test_Slow_Task, 120, 40, 50, STD_OFF)
+
+void Test_Fast_Task(void);
+void Test_Slow_Task(void);
+
+#include "Os_HostPort.c"
+#include "Test.h"
+#include "Bench.h"
+
+/* Core clock cycles of one minor frame at 80 MHz */
+#define BENCH_FRAME_CYCLES      (80000U * OS_BASE_TIME)
+
+/* SysTick current value register */
+#define BENCH_SYSTICK_CURRENT   (0xE000E018U)
+
+/* SysTick counter value when Test_Slow_Task starts, near the end of its 1 frame period */
+#define BENCH_LATE_START_COUNT  (100U)
+
+/* Core clock cycles taken by Test_Slow_Task after the reload */
+#define BENCH_AFTER_RELOAD      (50U)
+
+/* Number of SysTick periods still to expire before the kernel is stopped */
+static uint32 Bench_Ticks_Left = 0;
+
+/* TRUE to make Test_Slow_Task run across the end of its period */
+static boolean Bench_Slow_Crosses_Reload = FALSE;
+
+void Init_Task(void)
+{
+    Mcu_Init();
+}
+
+void Test_Fast_Task(void)
+{
+}
+
+void Test_Slow_Task(void)
+{
+    if(Bench_Slow_Crosses_Reload == TRUE)
+    {
+        /* The period ends while the task runs: the tick interrupt programs the next periods, then the task goes on */
+        Os_HostPort_ExpireSysTick();
+        Sim_Poke(BENCH_SYSTICK_CURRENT, Sim_Peek(BENCH_SYSTICK_CURRENT) - BENCH_AFTER_RELOAD);
+    }
+}
+
+/* Each sleep of the idle loop lasts until the end of the SysTick period, the tasks of the tick start late */
+static void Bench_IdleHook(void)
+{
+    if(Bench_Ticks_Left == 0U)
+    {
+        Os_HostPort_Stop();
+    }
+    Bench_Ticks_Left--;
+    Os_HostPort_ExpireSysTick();
+    Sim_Poke(BENCH_SYSTICK_CURRENT, BENCH_LATE_START_COUNT);
+}
+
+/* Unprofiled Os_RunTasks (OS_TASK_PROFILING off) */
+BENCH_NOINLINE static void Bench_RunTasksDirect(uint32 Frame_Tasks)
+{
+    uint8 Task;
+
+    for(Task = 0; Frame_Tasks != 0; Task++, Frame_Tasks >>= 1)
+    {
+        if((Frame_Tasks & 1U) != 0)
+        {
+            g_Os_Tasks[Task].Task_Ptr();
+        }
+    }
+}
+
+/* The profiler costs two PPB reads of the SysTick counter per task run, the direct calls none */
+static void Bench_Overhead(void)
+{
+    Bench_ResultType Direct, Profiled;
+    Os_TaskStatsType Stats;
+
+    Sim_Reset();
+    Mcu_Init();
+    Os_BuildSchedule();
+    SysTick_Start(OS_BASE_TIME);
+
+    BENCH_MEASURE(Direct, Bench_RunTasksDirect(0x3U));
+    BENCH_MEASURE(Profiled, Os_RunTasks(0x3U));
+
+    printf("Os task dispatch of 2 tasks\n");
+    BENCH_PRINT("direct calls", Direct);
+    BENCH_PRINT("profiled (OS_TASK_PROFILING)", Profiled);
+    printf("  profiler overhead per task: %ld instr\n", ((long)Profiled.Instructions - (long)Direct.Instructions) / 2L);
+
+    TEST_CHECK_EQUAL(0U, Direct.Reads + Direct.Writes);
+    TEST_CHECK_EQUAL(4U, Profiled.Reads);
+    TEST_CHECK_EQUAL(0U, Profiled.Writes);
+    TEST_CHECK_EQUAL(4U * SIM_PPB_ACCESS_CYCLES, Profiled.Bus_Cycles);
+
+    TEST_CHECK(Os_GetTaskStats(OS_TASK_ID_Test_Fast_Task, &Stats) == E_OK);
+    TEST_CHECK_EQUAL(1U, Stats.Runs);
+    TEST_CHECK(Os_GetTaskStats(OS_TASK_ID_Test_Slow_Task, &Stats) == E_OK);
+    TEST_CHECK_EQUAL(1U, Stats.Runs);
+}
+
+/*
+ * Test_Slow_Task starts BENCH_LATE_START_COUNT cycles before the end of its 1 frame period and the tick
+ * at the reload moves g_Period_Cycles to the 3 frames period that follows: the execution time spans
+ * the end of the first period and the start of the second one, the latency is taken in the first one
+ */
+static void Bench_ReloadDuringTask(void)
+{
+    Os_TaskStatsType Stats;
+
+    Sim_Reset();
+    Bench_Ticks_Left = 1U;
+    Bench_Slow_Crosses_Reload = TRUE;
+    Os_HostPort_SetIdleHook(Bench_IdleHook);
+    Os_HostPort_Run(Os_start);
+    Bench_Slow_Crosses_Reload = FALSE;
+
+    TEST_CHECK_EQUAL(3U, g_Frame_Counter);
+    TEST_CHECK_EQUAL(3U * BENCH_FRAME_CYCLES, g_Period_Cycles);
+    TEST_CHECK(Os_GetTaskStats(OS_TASK_ID_Test_Slow_Task, &Stats) == E_OK);
+    TEST_CHECK_EQUAL(1U, Stats.Runs);
+    TEST_CHECK_EQUAL(BENCH_LATE_START_COUNT + 1U + BENCH_AFTER_RELOAD, Stats.Exec_Max);
+    TEST_CHECK_EQUAL(BENCH_FRAME_CYCLES - 1U - BENCH_LATE_START_COUNT, Stats.Start_Max);
+}
+
+int main(void)
+{
+    Sim_Init();
+
+    TEST_RUN(Bench_Overhead);
+    TEST_RUN(Bench_ReloadDuringTask);
+
+    return TEST_RESULT();
+}
@@ -0,0 +1,89 @@
+ /******************************************************************************
+ *
+ * Module: Test
+ *
+ * File Name: Bench_PortChannels.c
+ *
+ * Description: Size of the pins configuration and cost of the interpreted Port_Init for the
+ *              43 pins of Port_AllPins.h. Built once with the packed pins (PORT_PACKED_CHANNELS
+ *              = STD_ON) and once with the struct layout they replaced, the register accesses
+ *              are the same, only the table size and the field reads differ.
+ *
+ * Author: Tarek Emad
+ ******************************************************************************/
+
+#include "Test.h"
+#include "Bench.h"
+#include "Sim.h"
+#include "Port.h"
+
+/* Bytes of one pin in the pins configuration of each layout, the enums of the struct sized as ints */
+#if (PORT_PACKED_CHANNELS == STD_ON)
+#define BENCH_CHANNEL_BYTES     (2U)
+#define BENCH_LAYOUT_NAME       "packed uint16"
+#else
+#define BENCH_CHANNEL_BYTES     (24U)
+#define BENCH_LAYOUT_NAME       "struct"
+#endif
+
+/* GPIO register of a port in the aperture Port_Init uses for it */
+static uint32 Bench_PeekPortReg(uint8 Port, uint32 Offset)
+{
+    static const uint32 Apb_Base[PORT_NUMBER_OF_PORTS] = {
+        0x40004000U, 0x40005000U, 0x40006000U, 0x40007000U, 0x40024000U, 0x40025000U
+    };
+    uint32 Base = ((PORT_AHB_PORTS_MASK & (1U << Port)) != 0U) ? (0x40058000U + ((uint32)Port << 12)) : Apb_Base[Port];
+
+    return Sim_Peek(Base + Offset);
+}
+
+/* Bit of a pin in a GPIO register of its port */
+static uint8 Bench_PinBit(Port_ConfigChannel Pin_Config, uint32 Offset)
+{
+    return (uint8)((Bench_PeekPortReg(PORT_CHANNEL_PORT_NUM(Pin_Config), Offset) >> PORT_CHANNEL_PIN_NUM(Pin_Config)) & 1U);
+}
+
+/* Table size and Port_Init cost, then every configured pin read back from the registers */
+static void Bench_PortInit(void)
+{
+    Bench_ResultType Init;
+    Port_ConfigChannel Pin_Config;
+    Port_PinInitialMode Mode;
+    uint8 Channel;
+
+    Sim_Reset();
+    BENCH_MEASURE(Init, Port_Init(&Port_Configuration));
+
+    printf("Pins configuration of %u pins, %s: %lu bytes\n", PORT_CONFIGURED_PINS, BENCH_LAYOUT_NAME,
+           (unsigned long)sizeof(Port_Configuration.Channels));
+    BENCH_PRINT("Port_Init (interpreted)", Init);
+
+    TEST_CHECK_EQUAL(BENCH_CHANNEL_BYTES, sizeof(Port_ConfigChannel));
+    TEST_CHECK_EQUAL(PORT_CONFIGURED_PINS * BENCH_CHANNEL_BYTES, sizeof(Port_Configuration.Channels));
+
+    for (Channel = 0; Channel < PORT_CONFIGURED_PINS; Channel++)
+    {
+        Pin_Config = Port_Configuration.Channels[Channel];
+        Mode = PORT_CHANNEL_INITIAL_MODE(Pin_Config);
+        if (PORT_IS_JTAG_PIN(PORT_CHANNEL_PORT_NUM(Pin_Config), PORT_CHANNEL_PIN_NUM(Pin_Config)))
+        {
+            continue;
+        }
+        TEST_CHECK_EQUAL((PORT_CHANNEL_DIRECTION(Pin_Config) == OUTPUT) ? 1U : 0U, Bench_PinBit(Pin_Config, PORT_DIR_REG_OFFSET));
+        TEST_CHECK_EQUAL((Mode != PORT_PIN_MODE_ADC) ? 1U : 0U, Bench_PinBit(Pin_Config, PORT_DIGITAL_ENABLE_REG_OFFSET));
+        TEST_CHECK_EQUAL((Mode == PORT_PIN_MODE_ADC) ? 1U : 0U, Bench_PinBit(Pin_Config, PORT_ANALOG_MODE_SEL_REG_OFFSET));
+        TEST_CHECK_EQUAL(PORT_IS_ALT_MODE(Mode) ? 1U : 0U, Bench_PinBit(Pin_Config, PORT_ALT_FUNC_REG_OFFSET));
+        TEST_CHECK_EQUAL((PORT_CHANNEL_RESISTOR(Pin_Config) == PULL_UP) ? 1U : 0U, Bench_PinBit(Pin_Config, PORT_PULL_UP_REG_OFFSET));
+        TEST_CHECK_EQUAL((PORT_CHANNEL_RESISTOR(Pin_Config) == PULL_DOWN) ? 1U : 0U, Bench_PinBit(Pin_Config, PORT_PULL_DOWN_REG_OFFSET));
+        TEST_CHECK_EQUAL(PORT_CHANNEL_INITIAL_VALUE(Pin_Config), Bench_PinBit(Pin_Config, PORT_DATA_REG_OFFSET));
+    }
+}
+
+int main(void)
+{
+    Sim_Init();
+
+    TEST_RUN(Bench_PortInit);
+
+    return TEST_RESULT();
+}
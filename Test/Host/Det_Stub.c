@@ -0,0 +1,44 @@
+ /******************************************************************************
+ *
+ * Module: Det
+ *
+ * File Name: Det_Stub.c
+ *
+ * Description: Host replacement of Det which records the reported errors
+ *              instead of halting.
+ *
+ * Author: Tarek Emad
+ ******************************************************************************/
+
+#include "Det_Stub.h"
+
+static uint32 Det_Stub_Count = 0;
+static Det_StubErrorType Det_Stub_Last;
+
+Std_ReturnType Det_ReportError( uint16 ModuleId,
+                                uint8 InstanceId,
+                                uint8 ApiId,
+                                uint8 ErrorId )
+{
+    Det_Stub_Count++;
+    Det_Stub_Last.ModuleId   = ModuleId;
+    Det_Stub_Last.InstanceId = InstanceId;
+    Det_Stub_Last.ApiId      = ApiId;
+    Det_Stub_Last.ErrorId    = ErrorId;
+    return E_OK;
+}
+
+uint32 Det_StubGetCount(void)
+{
+    return Det_Stub_Count;
+}
+
+void Det_StubGetLast(Det_StubErrorType *Error_Ptr)
+{
+    *Error_Ptr = Det_Stub_Last;
+}
+
+void Det_StubReset(void)
+{
+    Det_Stub_Count = 0;
+}
@@ -0,0 +1,36 @@
+ /******************************************************************************
+ *
+ * Module: Det
+ *
+ * File Name: Det_Stub.h
+ *
+ * Description: Host replacement of Det which records the reported errors
+ *              instead of halting.
+ *
+ * Author: Tarek Emad
+ ******************************************************************************/
+
+#ifndef DET_STUB_H
+#define DET_STUB_H
+
+#include "Det.h"
+
+/* Last error reported to Det */
+typedef struct
+{
+    uint16 ModuleId;
+    uint8  InstanceId;
+    uint8  ApiId;
+    uint8  ErrorId;
+} Det_StubErrorType;
+
+/* Number of the errors reported since the last Det_StubReset */
+uint32 Det_StubGetCount(void);
+
+/* Last error reported since the last Det_StubReset */
+void Det_StubGetLast(Det_StubErrorType *Error_Ptr);
+
+/* Forget the reported errors */
+void Det_StubReset(void);
+
+#endif /* DET_STUB_H */
@@ -0,0 +1,266 @@
+ /******************************************************************************
+ *
+ * Module: Os
+ *
+ * File Name: Os_HostPort.c
+ *
+ * Description: Host build of the Os kernel. A test includes this file to compile
+ *              Os.c with the host port and to reach the kernel state. In the preemptive
+ *              mode each task runs on its own host context switched by PendSV_Handler.
+ *
+ * Author: Tarek Emad
+ ******************************************************************************/
+
+#include <string.h>
+#include <ucontext.h>
+#include "Os_HostPort.h"
+#include "Os.c"
+#include "Sim.h"
+
+/* Stack of the context running the kernel, the simulator fault handlers also run on it */
+#define OS_HOSTPORT_STACK_SIZE          (64U * 1024U)
+
+/* Maximum number of interrupts pending at the same time */
+#define OS_HOSTPORT_PENDING_MAX         (8U)
+
+/* SysTick registers */
+#define OS_HOSTPORT_SYSTICK_CTRL        (0xE000E010U)
+#define OS_HOSTPORT_SYSTICK_RELOAD      (0xE000E014U)
+#define OS_HOSTPORT_SYSTICK_CURRENT     (0xE000E018U)
+#define OS_HOSTPORT_COUNTFLAG_MASK      (0x00010000U)
+
+#if (OS_PREEMPTIVE == STD_ON)
+/* Interrupt Control and State register */
+#define OS_HOSTPORT_ICSR                (0xE000ED04U)
+#define OS_HOSTPORT_PENDSVSET_MASK      (0x10000000U)
+
+/* R0 of the initial frame stacked by Os_BuildTasks (after R4-R11 and EXC_RETURN) */
+#define OS_HOSTPORT_FRAME_R0            (9U)
+#endif
+
+/* SysTick exception handler of Gpt.c, installed in the vector table on the device */
+void SysTick_Handler(void);
+
+/* PRIMASK */
+static boolean Os_HostPort_Masked = FALSE;
+
+/* TRUE while an interrupt is served, the other pending interrupts wait for its return */
+static boolean Os_HostPort_In_Handler = FALSE;
+
+/* Pending interrupts in the order they were raised */
+static Os_HostPort_IsrType Os_HostPort_Pending[OS_HOSTPORT_PENDING_MAX];
+static uint32 Os_HostPort_Pending_Count = 0;
+
+/* Called each time the idle loop sleeps */
+static void (*Os_HostPort_Idle_Hook)(void) = NULL_PTR;
+
+/* Context of the caller of Os_HostPort_Run and context running the kernel */
+static ucontext_t Os_HostPort_Caller_Context;
+static ucontext_t Os_HostPort_Kernel_Context;
+static uint64 Os_HostPort_Kernel_Stack[OS_HOSTPORT_STACK_SIZE / 8U];
+
+#if (OS_PREEMPTIVE == STD_ON)
+/* Context of the task of each priority, the last one is the idle loop which keeps the kernel context */
+static ucontext_t Os_HostPort_Task_Context[OS_TASKS_NUMBER + 1U];
+static uint64 Os_HostPort_Task_Stack[OS_TASKS_NUMBER][OS_HOSTPORT_STACK_SIZE / 8U];
+
+/* TRUE once the task of a priority got its context at its first switch */
+static boolean Os_HostPort_Task_Started[OS_TASKS_NUMBER];
+
+/* TRUE once the idle loop runs, PendSV is not taken before as on the device the interrupts are masked */
+static boolean Os_HostPort_Idle_Started = FALSE;
+
+/*********************************************************************************************/
+/* Description: First code run on the context of a task, the priority comes from its initial frame */
+static void Os_HostPort_TaskStart(void)
+{
+    Os_TaskEntry(g_Os_Current_Tcb->Sp[OS_HOSTPORT_FRAME_R0]);
+}
+
+/*********************************************************************************************/
+/* Description: Context switch of the preemptive mode, the host context of the running task is saved
+ *              instead of its registers, the stacks of g_Os_Stacks only hold the initial frames */
+void PendSV_Handler(void)
+{
+    uint32 Current = (uint32)(g_Os_Current_Tcb - g_Os_Tcbs);
+    uint32 Next = (uint32)(g_Os_Next_Tcb - g_Os_Tcbs);
+
+    /* The pending bit is cleared when the exception is taken */
+    Sim_Poke(OS_HOSTPORT_ICSR, Sim_Peek(OS_HOSTPORT_ICSR) & ~OS_HOSTPORT_PENDSVSET_MASK);
+    g_Os_Current_Tcb = g_Os_Next_Tcb;
+
+    if(Next != Current)
+    {
+        if((Next < OS_TASKS_NUMBER) && (Os_HostPort_Task_Started[Next] == FALSE))
+        {
+            Os_HostPort_Task_Started[Next] = TRUE;
+            (void)getcontext(&Os_HostPort_Task_Context[Next]);
+            Os_HostPort_Task_Context[Next].uc_stack.ss_sp = Os_HostPort_Task_Stack[Next];
+            Os_HostPort_Task_Context[Next].uc_stack.ss_size = sizeof(Os_HostPort_Task_Stack[Next]);
+            Os_HostPort_Task_Context[Next].uc_link = NULL_PTR; /* Os_TaskEntry never returns */
+            makecontext(&Os_HostPort_Task_Context[Next], Os_HostPort_TaskStart, 0);
+        }
+        (void)swapcontext(&Os_HostPort_Task_Context[Current], &Os_HostPort_Task_Context[Next]);
+    }
+}
+
+/*********************************************************************************************/
+/* Description: The idle loop runs on the kernel context, Stack_Top is only used on the device */
+void Os_StartIdle(uint32 *Stack_Top, void (*Idle_Func)(void))
+{
+    (void)Stack_Top;
+    Os_HostPort_Idle_Started = TRUE;
+    Os_HostPort_EnableInterrupts();
+    Idle_Func();
+}
+#endif
+
+/*********************************************************************************************/
+/* Description: TRUE if a context switch is requested and can be taken */
+static boolean Os_HostPort_IsPendSvPending(void)
+{
+#if (OS_PREEMPTIVE == STD_ON)
+    return (boolean)((Os_HostPort_Idle_Started == TRUE) && ((Sim_Peek(OS_HOSTPORT_ICSR) & OS_HOSTPORT_PENDSVSET_MASK) != 0U));
+#else
+    return FALSE;
+#endif
+}
+
+/*********************************************************************************************/
+/* Description: Run the pending interrupts in order if PRIMASK is clear, nothing is done from an interrupt,
+ *              PendSV has the lowest priority and is taken last */
+static void Os_HostPort_Serve(void)
+{
+    Os_HostPort_IsrType Isr;
+    uint32 Index;
+
+    while((Os_HostPort_Masked == FALSE) && (Os_HostPort_In_Handler == FALSE) &&
+          ((Os_HostPort_Pending_Count != 0U) || (Os_HostPort_IsPendSvPending() == TRUE)))
+    {
+        if(Os_HostPort_Pending_Count != 0U)
+        {
+            Isr = Os_HostPort_Pending[0];
+            Os_HostPort_Pending_Count--;
+            for(Index = 0; Index < Os_HostPort_Pending_Count; Index++)
+            {
+                Os_HostPort_Pending[Index] = Os_HostPort_Pending[Index + 1U];
+            }
+
+            Os_HostPort_In_Handler = TRUE;
+            Isr();
+            Os_HostPort_In_Handler = FALSE;
+        }
+#if (OS_PREEMPTIVE == STD_ON)
+        else
+        {
+            /* Returns once the running task is switched back in, then the serving goes on */
+            PendSV_Handler();
+        }
+#endif
+    }
+}
+
+/*********************************************************************************************/
+/* Description: Restore the kernel state of a device reset */
+static void Os_HostPort_ResetKernel(void)
+{
+    memset(&g_Os_Idle_Stats, 0, sizeof(g_Os_Idle_Stats));
+    memset(&g_Os_Overload_Stats, 0, sizeof(g_Os_Overload_Stats));
+    g_Frame_Index = 0;
+    g_Frame_Counter = 0;
+    g_Frame_Running_Flag = 0;
+    g_Overrun_Flag = 0;
+    g_New_Time_Tick_Flag = 0;
+#if (OS_PREEMPTIVE == STD_OFF)
+    g_Dispatched_Frame_Counter = 0;
+    g_Os_Event_Tasks = 0;
+#else
+    g_Os_Ready_Mask = 0;
+    g_Os_Event_Ready_Mask = 0;
+    memset(Os_HostPort_Task_Started, 0, sizeof(Os_HostPort_Task_Started));
+    Os_HostPort_Idle_Started = FALSE;
+#endif
+#if (OS_TICKLESS == STD_ON)
+    g_Next_Frame_Index = 0;
+#endif
+#if (OS_TASK_PROFILING == STD_ON)
+    memset(g_Os_Task_Stats, 0, sizeof(g_Os_Task_Stats));
+    memset(g_Os_Task_Exec_Total, 0, sizeof(g_Os_Task_Exec_Total));
+    g_Os_Busy_Cycles = 0;
+#endif
+}
+
+/*********************************************************************************************/
+void Os_HostPort_EnableInterrupts(void)
+{
+    Os_HostPort_Masked = FALSE;
+    Os_HostPort_Serve();
+}
+
+/*********************************************************************************************/
+void Os_HostPort_DisableInterrupts(void)
+{
+    Os_HostPort_Masked = TRUE;
+}
+
+/*********************************************************************************************/
+void Os_HostPort_WaitForInterrupt(void)
+{
+    while(Os_HostPort_Pending_Count == 0U)
+    {
+        if(Os_HostPort_Idle_Hook == NULL_PTR)
+        {
+            /* Nothing can wake the CPU up */
+            Os_HostPort_Stop();
+        }
+        Os_HostPort_Idle_Hook();
+    }
+}
+
+/*********************************************************************************************/
+void Os_HostPort_RaiseInterrupt(Os_HostPort_IsrType Isr)
+{
+    if(Os_HostPort_Pending_Count < OS_HOSTPORT_PENDING_MAX)
+    {
+        Os_HostPort_Pending[Os_HostPort_Pending_Count] = Isr;
+        Os_HostPort_Pending_Count++;
+    }
+    Os_HostPort_Serve();
+}
+
+/*********************************************************************************************/
+void Os_HostPort_ExpireSysTick(void)
+{
+    /* The counter wraps to the reload value programmed for the next period */
+    Sim_Poke(OS_HOSTPORT_SYSTICK_CURRENT, Sim_Peek(OS_HOSTPORT_SYSTICK_RELOAD));
+    Sim_Poke(OS_HOSTPORT_SYSTICK_CTRL, Sim_Peek(OS_HOSTPORT_SYSTICK_CTRL) | OS_HOSTPORT_COUNTFLAG_MASK);
+    Os_HostPort_RaiseInterrupt(SysTick_Handler);
+}
+
+/*********************************************************************************************/
+void Os_HostPort_SetIdleHook(void (*Hook)(void))
+{
+    Os_HostPort_Idle_Hook = Hook;
+}
+
+/*********************************************************************************************/
+void Os_HostPort_Run(void (*Entry)(void))
+{
+    Os_HostPort_ResetKernel();
+    Os_HostPort_Masked = FALSE;
+    Os_HostPort_In_Handler = FALSE;
+    Os_HostPort_Pending_Count = 0;
+
+    (void)getcontext(&Os_HostPort_Kernel_Context);
+    Os_HostPort_Kernel_Context.uc_stack.ss_sp = Os_HostPort_Kernel_Stack;
+    Os_HostPort_Kernel_Context.uc_stack.ss_size = sizeof(Os_HostPort_Kernel_Stack);
+    Os_HostPort_Kernel_Context.uc_link = &Os_HostPort_Caller_Context;
+    makecontext(&Os_HostPort_Kernel_Context, Entry, 0);
+    (void)swapcontext(&Os_HostPort_Caller_Context, &Os_HostPort_Kernel_Context);
+}
+
+/*********************************************************************************************/
+void Os_HostPort_Stop(void)
+{
+    (void)setcontext(&Os_HostPort_Caller_Context);
+}
@@ -0,0 +1,54 @@
+ /******************************************************************************
+ *
+ * Module: Os
+ *
+ * File Name: Os_HostPort.h
+ *
+ * Description: Host port of the Os kernel: PRIMASK, WFI, the interrupts and the PendSV
+ *              context switch are emulated so the scheduler runs in virtual time on the simulator.
+ *
+ * Author: Tarek Emad
+ ******************************************************************************/
+
+#ifndef OS_HOSTPORT_H
+#define OS_HOSTPORT_H
+
+#include "Std_Types.h"
+
+/* Os.c takes its Cortex-M instructions from this port */
+#define OS_HOST_PORT
+
+#define Enable_Exceptions()    Os_HostPort_EnableInterrupts()
+#define Disable_Exceptions()   Os_HostPort_DisableInterrupts()
+#define Enable_Faults()
+#define Disable_Faults()
+#define Wait_For_Interrupt()   Os_HostPort_WaitForInterrupt()
+
+/* Interrupt service routine raised by a test */
+typedef void (*Os_HostPort_IsrType)(void);
+
+/* Clear PRIMASK, the pending interrupts run at once unless an interrupt is being served */
+void Os_HostPort_EnableInterrupts(void);
+
+/* Set PRIMASK, the raised interrupts stay pending */
+void Os_HostPort_DisableInterrupts(void);
+
+/* Call the idle hook until an interrupt is pending, the interrupt runs once PRIMASK is cleared */
+void Os_HostPort_WaitForInterrupt(void);
+
+/* Make an interrupt pending, it runs at once if PRIMASK is clear and no interrupt is being served */
+void Os_HostPort_RaiseInterrupt(Os_HostPort_IsrType Isr);
+
+/* End the running SysTick period: reload the counter, set COUNTFLAG and raise SysTick_Handler */
+void Os_HostPort_ExpireSysTick(void);
+
+/* Install the function called each time the idle loop sleeps, it raises the next interrupt or stops the kernel */
+void Os_HostPort_SetIdleHook(void (*Hook)(void));
+
+/* Restore the kernel state of a device reset then run Entry (e.g. Os_start) until Os_HostPort_Stop is called */
+void Os_HostPort_Run(void (*Entry)(void));
+
+/* Leave the kernel and return from Os_HostPort_Run */
+void Os_HostPort_Stop(void);
+
+#endif /* OS_HOSTPORT_H */
@@ -0,0 +1,63 @@
+ /******************************************************************************
+ *
+ * Module: Test
+ *
+ * File Name: Port_AllPins.h
+ *
+ * Description: Pins configuration forced into Port_Cfg.h/Port_PBcfg.c by the pins layout
+ *              benchmark: the 43 GPIO pins of the TM4C123GH6PM, PC0-PC3 (JTAG) included.
+ *
+ * Author: Tarek Emad
+ ******************************************************************************/
+
+#ifndef PORT_ALL_PINS_H
+#define PORT_ALL_PINS_H
+
+#define PORT_CONFIGURED_PINS            (43U)
+
+#define PORT_CONFIGURED_PINS_LIST(PIN, ARG) \
+    PIN(ARG, 0, 0, INPUT,  OFF,       STD_LOW,  PORT_PIN_MODE_ALT1,  STD_ON,  STD_ON)  /* PA0 U0Rx */      \
+    PIN(ARG, 0, 1, OUTPUT, OFF,       STD_HIGH, PORT_PIN_MODE_ALT1,  STD_ON,  STD_ON)  /* PA1 U0Tx */      \
+    PIN(ARG, 0, 2, OUTPUT, OFF,       STD_LOW,  PORT_PIN_MODE_DIO,   STD_ON,  STD_ON)                      \
+    PIN(ARG, 0, 3, OUTPUT, OFF,       STD_HIGH, PORT_PIN_MODE_DIO,   STD_ON,  STD_ON)                      \
+    PIN(ARG, 0, 4, INPUT,  PULL_UP,   STD_LOW,  PORT_PIN_MODE_DIO,   STD_ON,  STD_ON)                      \
+    PIN(ARG, 0, 5, INPUT,  PULL_DOWN, STD_LOW,  PORT_PIN_MODE_DIO,   STD_ON,  STD_ON)                      \
+    PIN(ARG, 0, 6, OUTPUT, OFF,       STD_LOW,  PORT_PIN_MODE_DIO,   STD_OFF, STD_ON)                      \
+    PIN(ARG, 0, 7, OUTPUT, OFF,       STD_LOW,  PORT_PIN_MODE_DIO,   STD_OFF, STD_ON)                      \
+    PIN(ARG, 1, 0, INPUT,  PULL_UP,   STD_LOW,  PORT_PIN_MODE_DIO,   STD_ON,  STD_ON)                      \
+    PIN(ARG, 1, 1, INPUT,  PULL_UP,   STD_LOW,  PORT_PIN_MODE_DIO,   STD_ON,  STD_ON)                      \
+    PIN(ARG, 1, 2, OUTPUT, OFF,       STD_LOW,  PORT_PIN_MODE_ALT3,  STD_ON,  STD_ON)  /* PB2 I2C0SCL */   \
+    PIN(ARG, 1, 3, OUTPUT, OFF,       STD_LOW,  PORT_PIN_MODE_ALT3,  STD_ON,  STD_ON)  /* PB3 I2C0SDA */   \
+    PIN(ARG, 1, 4, OUTPUT, OFF,       STD_LOW,  PORT_PIN_MODE_DIO,   STD_ON,  STD_ON)                      \
+    PIN(ARG, 1, 5, OUTPUT, OFF,       STD_HIGH, PORT_PIN_MODE_DIO,   STD_ON,  STD_ON)                      \
+    PIN(ARG, 1, 6, INPUT,  PULL_DOWN, STD_LOW,  PORT_PIN_MODE_DIO,   STD_ON,  STD_ON)                      \
+    PIN(ARG, 1, 7, INPUT,  PULL_DOWN, STD_LOW,  PORT_PIN_MODE_DIO,   STD_ON,  STD_ON)                      \
+    PIN(ARG, 2, 0, INPUT,  OFF,       STD_LOW,  PORT_PIN_MODE_DIO,   STD_ON,  STD_ON)  /* PC0 JTAG, skipped */ \
+    PIN(ARG, 2, 1, INPUT,  OFF,       STD_LOW,  PORT_PIN_MODE_DIO,   STD_ON,  STD_ON)  /* PC1 JTAG, skipped */ \
+    PIN(ARG, 2, 2, INPUT,  OFF,       STD_LOW,  PORT_PIN_MODE_DIO,   STD_ON,  STD_ON)  /* PC2 JTAG, skipped */ \
+    PIN(ARG, 2, 3, INPUT,  OFF,       STD_LOW,  PORT_PIN_MODE_DIO,   STD_ON,  STD_ON)  /* PC3 JTAG, skipped */ \
+    PIN(ARG, 2, 4, OUTPUT, OFF,       STD_LOW,  PORT_PIN_MODE_DIO,   STD_ON,  STD_ON)                      \
+    PIN(ARG, 2, 5, OUTPUT, OFF,       STD_LOW,  PORT_PIN_MODE_DIO,   STD_ON,  STD_ON)                      \
+    PIN(ARG, 2, 6, INPUT,  PULL_UP,   STD_LOW,  PORT_PIN_MODE_DIO,   STD_ON,  STD_ON)                      \
+    PIN(ARG, 2, 7, INPUT,  PULL_UP,   STD_LOW,  PORT_PIN_MODE_DIO,   STD_ON,  STD_ON)                      \
+    PIN(ARG, 3, 0, OUTPUT, OFF,       STD_LOW,  PORT_PIN_MODE_DIO,   STD_ON,  STD_ON)                      \
+    PIN(ARG, 3, 1, OUTPUT, OFF,       STD_LOW,  PORT_PIN_MODE_DIO,   STD_ON,  STD_ON)                      \
+    PIN(ARG, 3, 2, INPUT,  OFF,       STD_LOW,  PORT_PIN_MODE_ADC,   STD_ON,  STD_OFF) /* PD2 AIN5 */      \
+    PIN(ARG, 3, 3, INPUT,  OFF,       STD_LOW,  PORT_PIN_MODE_ADC,   STD_ON,  STD_OFF) /* PD3 AIN4 */      \
+    PIN(ARG, 3, 4, INPUT,  PULL_DOWN, STD_LOW,  PORT_PIN_MODE_DIO,   STD_ON,  STD_ON)                      \
+    PIN(ARG, 3, 5, INPUT,  PULL_DOWN, STD_LOW,  PORT_PIN_MODE_DIO,   STD_ON,  STD_ON)                      \
+    PIN(ARG, 3, 6, OUTPUT, OFF,       STD_HIGH, PORT_PIN_MODE_DIO,   STD_ON,  STD_ON)                      \
+    PIN(ARG, 3, 7, INPUT,  PULL_UP,   STD_LOW,  PORT_PIN_MODE_DIO,   STD_ON,  STD_ON)  /* PD7 locked */    \
+    PIN(ARG, 4, 0, INPUT,  OFF,       STD_LOW,  PORT_PIN_MODE_ADC,   STD_ON,  STD_OFF) /* PE0 AIN3 */      \
+    PIN(ARG, 4, 1, INPUT,  OFF,       STD_LOW,  PORT_PIN_MODE_ADC,   STD_ON,  STD_OFF) /* PE1 AIN2 */      \
+    PIN(ARG, 4, 2, OUTPUT, OFF,       STD_LOW,  PORT_PIN_MODE_DIO,   STD_ON,  STD_ON)                      \
+    PIN(ARG, 4, 3, OUTPUT, OFF,       STD_LOW,  PORT_PIN_MODE_DIO,   STD_ON,  STD_ON)                      \
+    PIN(ARG, 4, 4, INPUT,  OFF,       STD_LOW,  PORT_PIN_MODE_ALT8,  STD_ON,  STD_ON)  /* PE4 CAN0Rx */    \
+    PIN(ARG, 4, 5, OUTPUT, OFF,       STD_LOW,  PORT_PIN_MODE_ALT8,  STD_ON,  STD_ON)  /* PE5 CAN0Tx */    \
+    PIN(ARG, 5, 0, INPUT,  PULL_UP,   STD_LOW,  PORT_PIN_MODE_DIO,   STD_ON,  STD_ON)  /* PF0 SW2, locked */ \
+    PIN(ARG, 5, 1, OUTPUT, OFF,       STD_HIGH, PORT_PIN_MODE_DIO,   STD_ON,  STD_ON)  /* PF1 LED1 */      \
+    PIN(ARG, 5, 2, OUTPUT, OFF,       STD_LOW,  PORT_PIN_MODE_DIO,   STD_ON,  STD_ON)  /* PF2 LED2 */      \
+    PIN(ARG, 5, 3, OUTPUT, OFF,       STD_LOW,  PORT_PIN_MODE_DIO,   STD_ON,  STD_ON)  /* PF3 LED3 */      \
+    PIN(ARG, 5, 4, INPUT,  PULL_UP,   STD_LOW,  PORT_PIN_MODE_DIO,   STD_ON,  STD_ON)  /* PF4 SW1 */
+
+#endif /* PORT_ALL_PINS_H */
@@ -0,0 +1,32 @@
+ /******************************************************************************
+ *
+ * Module: Test
+ *
+ * File Name: Port_TestPins.h
+ *
+ * Description: Pins configuration forced into Port_Cfg.h/Port_PBcfg.c by the image
+ *              tests: every initial mode family, both resistors, a JTAG pin, both
+ *              locked pins and pins whose direction is refreshed.
+ *
+ * Author: Tarek Emad
+ ******************************************************************************/
+
+#ifndef PORT_TEST_PINS_H
+#define PORT_TEST_PINS_H
+
+#define PORT_CONFIGURED_PINS            (11U)
+
+#define PORT_CONFIGURED_PINS_LIST(PIN, ARG) \
+    PIN(ARG, 0, 0, INPUT,  OFF,       STD_LOW,  PORT_PIN_MODE_ALT1,  STD_ON,  STD_ON)  /* PA0 U0Rx */        \
+    PIN(ARG, 0, 1, OUTPUT, OFF,       STD_HIGH, PORT_PIN_MODE_ALT1,  STD_ON,  STD_ON)  /* PA1 U0Tx */        \
+    PIN(ARG, 1, 3, INPUT,  PULL_DOWN, STD_LOW,  PORT_PIN_MODE_DIO,   STD_OFF, STD_ON)  /* PB3 refreshed */   \
+    PIN(ARG, 2, 1, INPUT,  OFF,       STD_LOW,  PORT_PIN_MODE_DIO,   STD_OFF, STD_ON)  /* PC1 JTAG, skipped */ \
+    PIN(ARG, 2, 6, OUTPUT, OFF,       STD_HIGH, PORT_PIN_MODE_DIO,   STD_ON,  STD_ON)  /* PC6 */             \
+    PIN(ARG, 3, 7, INPUT,  PULL_UP,   STD_LOW,  PORT_PIN_MODE_DIO,   STD_ON,  STD_ON)  /* PD7 locked */      \
+    PIN(ARG, 4, 3, INPUT,  OFF,       STD_LOW,  PORT_PIN_MODE_ADC,   STD_ON,  STD_OFF) /* PE3 AIN0 */        \
+    PIN(ARG, 4, 4, OUTPUT, OFF,       STD_LOW,  PORT_PIN_MODE_ALT8,  STD_ON,  STD_ON)  /* PE4 CAN0Rx */      \
+    PIN(ARG, 5, 0, INPUT,  PULL_UP,   STD_LOW,  PORT_PIN_MODE_DIO,   STD_ON,  STD_ON)  /* PF0 locked */      \
+    PIN(ARG, 5, 2, OUTPUT, OFF,       STD_LOW,  PORT_PIN_MODE_ALT14, STD_OFF, STD_OFF) /* PF2 */             \
+    PIN(ARG, 5, 3, OUTPUT, PULL_DOWN, STD_HIGH, PORT_PIN_MODE_ALT15, STD_ON,  STD_ON)  /* PF3 */
+
+#endif /* PORT_TEST_PINS_H */
@@ -0,0 +1,818 @@
+ /******************************************************************************
+ *
+ * Module: Sim
+ *
+ * File Name: Sim.c
+ *
+ * Description: Source file for the host simulation of the TM4C123GH6PM GPIO,
+ *              system control and private peripheral bus registers.
+ *
+ * Author: Tarek Emad
+ ******************************************************************************/
+
+#define _GNU_SOURCE
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <ucontext.h>
+
+#include "Sim.h"
+
+/* Device address ranges mapped on the host at the same addresses */
+#define SIM_PERIPH_BASE             (0x40000000UL)
+#define SIM_PERIPH_SIZE             (0x00100000UL)
+#define SIM_BITBAND_BASE            (0x42000000UL)
+#define SIM_BITBAND_SIZE            (0x02000000UL)
+#define SIM_PPB_BASE                (0xE000E000UL)
+#define SIM_PPB_SIZE                (0x00001000UL)
+#define SIM_PAGE_SIZE               (0x00001000UL)
+
+/* System control registers offsets */
+#define SIM_SYSCTL_BASE             (0x400FE000UL)
+#define SIM_SYSCTL_RIS              (0x050U)
+#define SIM_SYSCTL_RCC              (0x060U)
+#define SIM_SYSCTL_GPIOHBCTL        (0x06CU)
+#define SIM_SYSCTL_RCC2             (0x070U)
+#define SIM_SYSCTL_RCGCGPIO         (0x608U)
+#define SIM_SYSCTL_PRGPIO           (0xA08U)
+
+/* RCC/RCC2 reset values and PLL bits */
+#define SIM_RCC_RESET               (0x078E3AD1U)
+#define SIM_RCC2_RESET              (0x07C06810U)
+#define SIM_RCC_PWRDN_MASK          (0x00002000U)
+#define SIM_RCC2_PWRDN2_MASK        (0x00002000U)
+#define SIM_RCC2_USERCC2_MASK       (0x80000000U)
+#define SIM_RIS_PLLLRIS_MASK        (0x00000040U)
+
+/* GPIO apertures and registers offsets */
+#define SIM_GPIO_AHB_BASE           (0x40058000UL)
+#define SIM_GPIO_DATA_END           (0x400U)
+#define SIM_GPIO_DIR                (0x400U)
+#define SIM_GPIO_IS                 (0x404U)
+#define SIM_GPIO_IBE                (0x408U)
+#define SIM_GPIO_IEV                (0x40CU)
+#define SIM_GPIO_IM                 (0x410U)
+#define SIM_GPIO_RIS                (0x414U)
+#define SIM_GPIO_MIS                (0x418U)
+#define SIM_GPIO_ICR                (0x41CU)
+#define SIM_GPIO_AFSEL              (0x420U)
+#define SIM_GPIO_PUR                (0x510U)
+#define SIM_GPIO_PDR                (0x514U)
+#define SIM_GPIO_DEN                (0x51CU)
+#define SIM_GPIO_LOCK               (0x520U)
+#define SIM_GPIO_CR                 (0x524U)
+#define SIM_GPIO_PCTL               (0x52CU)
+
+/* Private peripheral bus registers offsets */
+#define SIM_SYSTICK_CTRL            (0x010U)
+#define SIM_SYSTICK_RELOAD          (0x014U)
+#define SIM_SYSTICK_CURRENT         (0x018U)
+#define SIM_SYSTICK_COUNTER_MASK    (0x00FFFFFFU)
+#define SIM_SYSTICK_COUNTFLAG_MASK  (0x00010000U)
+#define SIM_NVIC_EN0                (0x100U)
+#define SIM_NVIC_EN4                (0x110U)
+#define SIM_NVIC_DIS0               (0x180U)
+#define SIM_NVIC_DIS4               (0x190U)
+#define SIM_SCB_ICSR                (0xD04U)
+#define SIM_ICSR_PENDSVSET_MASK     (0x10000000U)
+#define SIM_ICSR_PENDSVCLR_MASK     (0x08000000U)
+
+/* Trap flag of the host EFLAGS, single-steps the next instruction */
+#define SIM_EFLAGS_TF               (0x100UL)
+
+/* Write bit of the page fault error code */
+#define SIM_FAULT_WRITE_MASK        (0x2UL)
+
+/* Stack of the fault handlers, the tasks of the Os host port have their own small stacks */
+#define SIM_HANDLER_STACK_SIZE      (0x10000U)
+
+/* APB base address of each GPIO port */
+static const uint32 Sim_Gpio_Apb_Base[SIM_GPIO_PORTS_NUMBER] = {
+    0x40004000U, 0x40005000U, 0x40006000U, 0x40007000U, 0x40024000U, 0x40025000U
+};
+
+/* Pins of each port whose configuration is protected by GPIOLOCK/GPIOCR */
+static const uint8 Sim_Gpio_Protected_Pins[SIM_GPIO_PORTS_NUMBER] = {0x00U, 0x00U, 0x0FU, 0x80U, 0x00U, 0x01U};
+
+/* NVIC interrupt number of each GPIO port */
+static const uint8 Sim_Gpio_Irq[SIM_GPIO_PORTS_NUMBER] = {0U, 1U, 2U, 3U, 4U, 30U};
+
+/* Register file, the AHB aperture of a GPIO port shares the registers of its APB aperture */
+static uint32 Sim_Periph_Regs[SIM_PERIPH_SIZE / 4U];
+static uint32 Sim_Ppb_Regs[SIM_PPB_SIZE / 4U];
+
+/* Output latch, driven inputs and GPIOLOCK state of each GPIO port */
+static uint8 Sim_Gpio_Data[SIM_GPIO_PORTS_NUMBER];
+static uint8 Sim_Gpio_Inputs[SIM_GPIO_PORTS_NUMBER];
+static boolean Sim_Gpio_Locked[SIM_GPIO_PORTS_NUMBER];
+
+/* PRGPIO reads left before each enabled port is ready */
+static uint32 Sim_Prgpio_Delay = 0;
+static uint32 Sim_Prgpio_Polls[SIM_GPIO_PORTS_NUMBER];
+
+static Sim_CountersType Sim_Counters;
+static Sim_TraceType Sim_Trace[SIM_TRACE_SIZE];
+static uint32 Sim_Trace_Count = 0;
+static Sim_AccessHookType Sim_Access_Hook = NULL_PTR;
+
+/* Access being single-stepped */
+static volatile boolean Sim_Pending = FALSE;
+static uint32 Sim_Pending_Address;
+static boolean Sim_Pending_Write;
+static uint32 Sim_Pending_Before;
+
+/* Instruction counting */
+static volatile sig_atomic_t Sim_Stepping = 0;
+static volatile uint32 Sim_Instructions = 0;
+static uint32 Sim_Count_Overhead = 0;
+
+static boolean Sim_Initialized = FALSE;
+
+/*********************************************************************************************/
+/* Description: Host pointer of the window word of a device address */
+static volatile uint32 *Sim_Window(uint32 Address)
+{
+    return (volatile uint32 *)(unsigned long)Address;
+}
+
+/*********************************************************************************************/
+/* Description: Change the access rights of the window page holding Address */
+static void Sim_Protect(uint32 Address, int Prot)
+{
+    (void)mprotect((void *)(unsigned long)(Address & ~(SIM_PAGE_SIZE - 1U)), SIM_PAGE_SIZE, Prot);
+}
+
+/*********************************************************************************************/
+/* Description: Port whose APB or AHB aperture holds Address, SIM_GPIO_PORTS_NUMBER if none */
+static uint8 Sim_GpioPort(uint32 Address, boolean *Ahb_Ptr, uint32 *Offset_Ptr)
+{
+    uint8 Port;
+
+    for(Port = 0; Port < SIM_GPIO_PORTS_NUMBER; Port++)
+    {
+        if((Address - Sim_Gpio_Apb_Base[Port]) < SIM_PAGE_SIZE)
+        {
+            *Ahb_Ptr = FALSE;
+            *Offset_Ptr = Address - Sim_Gpio_Apb_Base[Port];
+            return Port;
+        }
+        if((Address - (SIM_GPIO_AHB_BASE + (Port * SIM_PAGE_SIZE))) < SIM_PAGE_SIZE)
+        {
+            *Ahb_Ptr = TRUE;
+            *Offset_Ptr = Address - (SIM_GPIO_AHB_BASE + (Port * SIM_PAGE_SIZE));
+            return Port;
+        }
+    }
+    return SIM_GPIO_PORTS_NUMBER;
+}
+
+/*********************************************************************************************/
+/* Description: Registers of a GPIO port */
+static uint32 *Sim_GpioRegs(uint8 Port)
+{
+    return &Sim_Periph_Regs[(Sim_Gpio_Apb_Base[Port] - SIM_PERIPH_BASE) / 4U];
+}
+
+/*********************************************************************************************/
+/* Description: Level of each pin of a GPIO port */
+static uint8 Sim_PinLevels(uint8 Port)
+{
+    uint32 Dir = Sim_GpioRegs(Port)[SIM_GPIO_DIR / 4U];
+
+    return (uint8)((Sim_Gpio_Data[Port] & Dir) | (Sim_Gpio_Inputs[Port] & ~Dir));
+}
+
+/*********************************************************************************************/
+/* Description: Target register and bit of a bit-band alias address */
+static uint32 Sim_BitbandTarget(uint32 Address, uint8 *Bit_Ptr)
+{
+    uint32 Offset = Address - SIM_BITBAND_BASE;
+
+    *Bit_Ptr = (uint8)((Offset >> 2) & 0x1FU);
+    return SIM_PERIPH_BASE + ((Offset >> 5) & ~3U);
+}
+
+/*********************************************************************************************/
+/* Description: Storage of a register */
+static uint32 *Sim_Storage(uint32 Address)
+{
+    boolean Ahb;
+    uint32 Offset;
+    uint8 Port = Sim_GpioPort(Address, &Ahb, &Offset);
+
+    if(Port < SIM_GPIO_PORTS_NUMBER)
+    {
+        return &Sim_GpioRegs(Port)[Offset / 4U];
+    }
+    else if((Address - SIM_PPB_BASE) < SIM_PPB_SIZE)
+    {
+        return &Sim_Ppb_Regs[(Address - SIM_PPB_BASE) / 4U];
+    }
+    else
+    {
+        return &Sim_Periph_Regs[(Address - SIM_PERIPH_BASE) / 4U];
+    }
+}
+
+/*********************************************************************************************/
+/* Description: Value read from a register, with the side effects of the read if Side_Effects is TRUE */
+static uint32 Sim_ReadReg(uint32 Address, boolean Side_Effects)
+{
+    boolean Ahb;
+    uint32 Offset;
+    uint8 Port;
+    uint8 Bit;
+    uint32 *Regs;
+    uint32 Value;
+
+    if((Address - SIM_BITBAND_BASE) < SIM_BITBAND_SIZE)
+    {
+        uint32 Target = Sim_BitbandTarget(Address, &Bit);
+        return (Sim_ReadReg(Target, Side_Effects) >> Bit) & 1U;
+    }
+
+    Port = Sim_GpioPort(Address, &Ahb, &Offset);
+    if(Port < SIM_GPIO_PORTS_NUMBER)
+    {
+        Regs = Sim_GpioRegs(Port);
+        if(Offset < SIM_GPIO_DATA_END)
+        {
+            /* Bits [9:2] of the address select the lanes */
+            return Sim_PinLevels(Port) & ((Offset >> 2) & 0xFFU);
+        }
+        switch(Offset)
+        {
+            case SIM_GPIO_LOCK:
+                return (Sim_Gpio_Locked[Port] == TRUE) ? 1U : 0U;
+            case SIM_GPIO_MIS:
+                return Regs[SIM_GPIO_RIS / 4U] & Regs[SIM_GPIO_IM / 4U];
+            case SIM_GPIO_ICR:
+                return 0U;
+            default:
+                return Regs[Offset / 4U];
+        }
+    }
+
+    if((Address - SIM_PPB_BASE) < SIM_PPB_SIZE)
+    {
+        Offset = Address - SIM_PPB_BASE;
+        Value = Sim_Ppb_Regs[Offset / 4U];
+        if((Offset == SIM_SYSTICK_CTRL) && (Side_Effects == TRUE))
+        {
+            /* COUNTFLAG is cleared by a read */
+            Sim_Ppb_Regs[Offset / 4U] &= ~SIM_SYSTICK_COUNTFLAG_MASK;
+        }
+        else if((Offset >= SIM_NVIC_DIS0) && (Offset <= SIM_NVIC_DIS4))
+        {
+            /* The clear-enable registers read as the set-enable ones */
+            Value = Sim_Ppb_Regs[(Offset - SIM_NVIC_DIS0 + SIM_NVIC_EN0) / 4U];
+        }
+        return Value;
+    }
+
+    Offset = Address - SIM_SYSCTL_BASE;
+    if((Offset == SIM_SYSCTL_PRGPIO) && (Side_Effects == TRUE))
+    {
+        uint32 Enabled = Sim_Periph_Regs[(SIM_SYSCTL_BASE + SIM_SYSCTL_RCGCGPIO - SIM_PERIPH_BASE) / 4U];
+
+        for(Port = 0; Port < SIM_GPIO_PORTS_NUMBER; Port++)
+        {
+            if((Enabled & (1U << Port)) == 0U)
+            {
+                continue;
+            }
+            if(Sim_Prgpio_Polls[Port] == 0U)
+            {
+                *Sim_Storage(Address) |= (1U << Port);
+            }
+            else
+            {
+                Sim_Prgpio_Polls[Port]--;
+            }
+        }
+    }
+    else if(Offset == SIM_SYSCTL_RIS)
+    {
+        uint32 Rcc = *Sim_Storage(SIM_SYSCTL_BASE + SIM_SYSCTL_RCC);
+        uint32 Rcc2 = *Sim_Storage(SIM_SYSCTL_BASE + SIM_SYSCTL_RCC2);
+        boolean Pll_Powered = ((Rcc2 & SIM_RCC2_USERCC2_MASK) != 0U) ? ((Rcc2 & SIM_RCC2_PWRDN2_MASK) == 0U)
+                                                                     : ((Rcc & SIM_RCC_PWRDN_MASK) == 0U);
+
+        /* The PLL locks as soon as it is powered */
+        return *Sim_Storage(Address) | ((Pll_Powered == TRUE) ? SIM_RIS_PLLLRIS_MASK : 0U);
+    }
+    return *Sim_Storage(Address);
+}
+
+/*********************************************************************************************/
+/* Description: Apply a value written to a register */
+static void Sim_WriteReg(uint32 Address, uint32 Value)
+{
+    boolean Ahb;
+    uint32 Offset;
+    uint8 Port;
+    uint8 Bit;
+    uint32 *Regs;
+
+    if((Address - SIM_BITBAND_BASE) < SIM_BITBAND_SIZE)
+    {
+        /* The bus does the read-modify-write of the target register */
+        uint32 Target = Sim_BitbandTarget(Address, &Bit);
+        uint32 Old = Sim_ReadReg(Target, FALSE);
+        Sim_WriteReg(Target, ((Value & 1U) != 0U) ? (Old | (1U << Bit)) : (Old & ~(1U << Bit)));
+        return;
+    }
+
+    Port = Sim_GpioPort(Address, &Ahb, &Offset);
+    if(Port < SIM_GPIO_PORTS_NUMBER)
+    {
+        Regs = Sim_GpioRegs(Port);
+        if(Offset < SIM_GPIO_DATA_END)
+        {
+            uint8 Lanes = (uint8)((Offset >> 2) & 0xFFU);
+            Sim_Gpio_Data[Port] = (uint8)((Sim_Gpio_Data[Port] & ~Lanes) | (Value & Lanes));
+            return;
+        }
+        switch(Offset)
+        {
+            case SIM_GPIO_LOCK:
+                /* Any other value than the key locks GPIOCR again */
+                Sim_Gpio_Locked[Port] = (Value == SIM_GPIO_UNLOCK_KEY) ? FALSE : TRUE;
+                break;
+            case SIM_GPIO_CR:
+                if(Sim_Gpio_Locked[Port] == TRUE)
+                {
+                    Sim_Counters.Lock_Violations++;
+                }
+                else
+                {
+                    /* Only the bits of the protected pins are writable, the others read as 1 */
+                    Regs[Offset / 4U] = (Value & Sim_Gpio_Protected_Pins[Port]) | (0xFFU & ~Sim_Gpio_Protected_Pins[Port]);
+                }
+                break;
+            case SIM_GPIO_AFSEL:
+            case SIM_GPIO_PUR:
+            case SIM_GPIO_PDR:
+            case SIM_GPIO_DEN:
+            {
+                uint32 Committed = Regs[SIM_GPIO_CR / 4U];
+                uint32 Old = Regs[Offset / 4U];
+
+                if(((Old ^ Value) & ~Committed & 0xFFU) != 0U)
+                {
+                    Sim_Counters.Commit_Violations++;
+                }
+                Regs[Offset / 4U] = ((Old & ~Committed) | (Value & Committed)) & 0xFFU;
+                break;
+            }
+            case SIM_GPIO_ICR:
+                Regs[SIM_GPIO_RIS / 4U] &= ~Value;
+                break;
+            case SIM_GPIO_RIS:
+            case SIM_GPIO_MIS:
+                /* Read only */
+                break;
+            default:
+                Regs[Offset / 4U] = Value;
+                break;
+        }
+        return;
+    }
+
+    if((Address - SIM_PPB_BASE) < SIM_PPB_SIZE)
+    {
+        Offset = Address - SIM_PPB_BASE;
+        if(Offset == SIM_SYSTICK_CURRENT)
+        {
+            /* Any write clears the counter and COUNTFLAG, the counter loads the reload value at the next clock */
+            Sim_Ppb_Regs[Offset / 4U] = Sim_Ppb_Regs[SIM_SYSTICK_RELOAD / 4U] & SIM_SYSTICK_COUNTER_MASK;
+            Sim_Ppb_Regs[SIM_SYSTICK_CTRL / 4U] &= ~SIM_SYSTICK_COUNTFLAG_MASK;
+        }
+        else if(Offset == SIM_SYSTICK_CTRL)
+        {
+            Sim_Ppb_Regs[Offset / 4U] = (Value & ~SIM_SYSTICK_COUNTFLAG_MASK) | (Sim_Ppb_Regs[Offset / 4U] & SIM_SYSTICK_COUNTFLAG_MASK);
+        }
+        else if(Offset == SIM_SCB_ICSR)
+        {
+            if((Value & SIM_ICSR_PENDSVSET_MASK) != 0U)
+            {
+                Sim_Ppb_Regs[Offset / 4U] |= SIM_ICSR_PENDSVSET_MASK;
+            }
+            if((Value & SIM_ICSR_PENDSVCLR_MASK) != 0U)
+            {
+                Sim_Ppb_Regs[Offset / 4U] &= ~SIM_ICSR_PENDSVSET_MASK;
+            }
+        }
+        else if((Offset >= SIM_NVIC_EN0) && (Offset <= SIM_NVIC_EN4))
+        {
+            Sim_Ppb_Regs[Offset / 4U] |= Value;
+        }
+        else if((Offset >= SIM_NVIC_DIS0) && (Offset <= SIM_NVIC_DIS4))
+        {
+            Sim_Ppb_Regs[(Offset - SIM_NVIC_DIS0 + SIM_NVIC_EN0) / 4U] &= ~Value;
+        }
+        else
+        {
+            Sim_Ppb_Regs[Offset / 4U] = Value;
+        }
+        return;
+    }
+
+    Offset = Address - SIM_SYSCTL_BASE;
+    if(Offset == SIM_SYSCTL_RCGCGPIO)
+    {
+        uint32 *Prgpio = Sim_Storage(SIM_SYSCTL_BASE + SIM_SYSCTL_PRGPIO);
+        uint32 Enabled = Value & ~(*Sim_Storage(Address));
+
+        for(Port = 0; Port < SIM_GPIO_PORTS_NUMBER; Port++)
+        {
+            if((Enabled & (1U << Port)) != 0U)
+            {
+                Sim_Prgpio_Polls[Port] = Sim_Prgpio_Delay;
+            }
+        }
+        /* A port whose clock is disabled is not ready anymore */
+        *Prgpio &= Value;
+        *Sim_Storage(Address) = Value;
+    }
+    else if((Offset == SIM_SYSCTL_PRGPIO) || (Offset == SIM_SYSCTL_RIS))
+    {
+        /* Read only */
+    }
+    else
+    {
+        *Sim_Storage(Address) = Value;
+    }
+}
+
+/*********************************************************************************************/
+/* Description: Count one access, check the GPIO clock and aperture and record it in the trace */
+static void Sim_Account(uint32 Address, uint32 Value, boolean Write)
+{
+    boolean Ahb;
+    uint32 Offset;
+    uint8 Port;
+    uint8 Bit;
+    uint32 Target = Address;
+    uint32 Cycles;
+    Sim_TraceType *Entry;
+
+    if(Write == TRUE)
+    {
+        Sim_Counters.Writes++;
+    }
+    else
+    {
+        Sim_Counters.Reads++;
+    }
+
+    if((Address - SIM_BITBAND_BASE) < SIM_BITBAND_SIZE)
+    {
+        Sim_Counters.Bitband_Accesses++;
+        Target = Sim_BitbandTarget(Address, &Bit);
+    }
+
+    if((Target - SIM_PPB_BASE) < SIM_PPB_SIZE)
+    {
+        Sim_Counters.Ppb_Accesses++;
+        Cycles = SIM_PPB_ACCESS_CYCLES;
+    }
+    else
+    {
+        Port = Sim_GpioPort(Target, &Ahb, &Offset);
+        if(Port < SIM_GPIO_PORTS_NUMBER)
+        {
+            uint32 Ready = *Sim_Storage(SIM_SYSCTL_BASE + SIM_SYSCTL_PRGPIO);
+            uint32 Hbctl = *Sim_Storage(SIM_SYSCTL_BASE + SIM_SYSCTL_GPIOHBCTL);
+
+            if(Ahb == TRUE)
+            {
+                Sim_Counters.Gpio_Ahb_Accesses++;
+                Cycles = SIM_AHB_ACCESS_CYCLES;
+            }
+            else
+            {
+                Sim_Counters.Gpio_Apb_Accesses++;
+                Cycles = SIM_APB_ACCESS_CYCLES;
+            }
+            if((Ready & (1U << Port)) == 0U)
+            {
+                Sim_Counters.Clock_Violations++;
+            }
+            if((((Hbctl >> Port) & 1U) != 0U) != (Ahb == TRUE))
+            {
+                Sim_Counters.Aperture_Violations++;
+            }
+        }
+        else
+        {
+            if((Target - SIM_SYSCTL_BASE) < SIM_PAGE_SIZE)
+            {
+                Sim_Counters.Sysctl_Accesses++;
+            }
+            Cycles = SIM_APB_ACCESS_CYCLES;
+        }
+    }
+
+    if((Target != Address) && (Write == TRUE))
+    {
+        /* A bit-band write is a read-modify-write of the target on the bus */
+        Cycles *= 2U;
+    }
+    Sim_Counters.Bus_Cycles += Cycles;
+
+    Entry = &Sim_Trace[Sim_Trace_Count % SIM_TRACE_SIZE];
+    Entry->Address = Address;
+    Entry->Value = Value;
+    Entry->Write = Write;
+    Sim_Trace_Count++;
+
+    if(Sim_Access_Hook != NULL_PTR)
+    {
+        /* The hook must not access the simulated registers */
+        Sim_Access_Hook(Entry);
+    }
+}
+
+/*********************************************************************************************/
+/* Description: TRUE if Address belongs to a simulated window */
+static boolean Sim_IsSimulated(unsigned long Address)
+{
+    return (((Address - SIM_PERIPH_BASE) < SIM_PERIPH_SIZE) ||
+            ((Address - SIM_BITBAND_BASE) < SIM_BITBAND_SIZE) ||
+            ((Address - SIM_PPB_BASE) < SIM_PPB_SIZE)) ? TRUE : FALSE;
+}
+
+/*********************************************************************************************/
+/* Description: Access to a window: load the modelled value and single-step the access */
+static void Sim_FaultHandler(int Signal, siginfo_t *Info, void *Context)
+{
+    ucontext_t *Uc = (ucontext_t *)Context;
+    unsigned long Fault = (unsigned long)Info->si_addr;
+    volatile uint32 *Window;
+
+    (void)Signal;
+    if((Sim_IsSimulated(Fault) == FALSE) || (Sim_Pending == TRUE))
+    {
+        /* Not a register access: fault again with the default action */
+        (void)signal(SIGSEGV, SIG_DFL);
+        return;
+    }
+
+    Sim_Pending = TRUE;
+    Sim_Pending_Address = (uint32)(Fault & ~3UL);
+    Sim_Pending_Write = ((Uc->uc_mcontext.gregs[REG_ERR] & SIM_FAULT_WRITE_MASK) != 0U) ? TRUE : FALSE;
+
+    Sim_Protect(Sim_Pending_Address, PROT_READ | PROT_WRITE);
+    Window = Sim_Window(Sim_Pending_Address);
+    *Window = Sim_ReadReg(Sim_Pending_Address, (Sim_Pending_Write == TRUE) ? FALSE : TRUE);
+    Sim_Pending_Before = *Window;
+
+    Uc->uc_mcontext.gregs[REG_EFL] |= SIM_EFLAGS_TF;
+}
+
+/*********************************************************************************************/
+/* Description: End of a single-stepped instruction: apply the access and count the instructions */
+static void Sim_TrapHandler(int Signal, siginfo_t *Info, void *Context)
+{
+    ucontext_t *Uc = (ucontext_t *)Context;
+    uint32 Value;
+
+    (void)Signal;
+    if(Info->si_code <= 0)
+    {
+        /* Raised by Sim_StartInstructionCount */
+        Uc->uc_mcontext.gregs[REG_EFL] |= SIM_EFLAGS_TF;
+        return;
+    }
+
+    if(Sim_Pending == TRUE)
+    {
+        Value = *Sim_Window(Sim_Pending_Address);
+        if(Sim_Pending_Write == FALSE)
+        {
+            Sim_Account(Sim_Pending_Address, Sim_Pending_Before, FALSE);
+        }
+        if((Sim_Pending_Write == TRUE) || (Value != Sim_Pending_Before))
+        {
+            /* An instruction reading and writing the register is also counted as a write */
+            Sim_WriteReg(Sim_Pending_Address, Value);
+            Sim_Account(Sim_Pending_Address, Value, TRUE);
+        }
+        Sim_Protect(Sim_Pending_Address, PROT_NONE);
+        Sim_Pending = FALSE;
+    }
+
+    if(Sim_Stepping != 0)
+    {
+        Sim_Instructions++;
+    }
+    else
+    {
+        Uc->uc_mcontext.gregs[REG_EFL] &= ~SIM_EFLAGS_TF;
+    }
+}
+
+/*********************************************************************************************/
+/* Description: Reserve a device range at the same host address without any access right */
+static void Sim_Map(unsigned long Base, unsigned long Size)
+{
+    void *Ptr = mmap((void *)Base, Size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE | MAP_FIXED_NOREPLACE, -1, 0);
+
+    if(Ptr != (void *)Base)
+    {
+        fprintf(stderr, "Sim: cannot map the device range 0x%08lX\n", Base);
+        exit(EXIT_FAILURE);
+    }
+}
+
+/*********************************************************************************************/
+void Sim_Init(void)
+{
+    static uint8 Handler_Stack[SIM_HANDLER_STACK_SIZE];
+    stack_t Stack;
+    struct sigaction Action;
+
+    if(Sim_Initialized == FALSE)
+    {
+        Sim_Map(SIM_PERIPH_BASE, SIM_PERIPH_SIZE);
+        Sim_Map(SIM_BITBAND_BASE, SIM_BITBAND_SIZE);
+        Sim_Map(SIM_PPB_BASE, SIM_PPB_SIZE);
+
+        Stack.ss_sp = Handler_Stack;
+        Stack.ss_size = sizeof(Handler_Stack);
+        Stack.ss_flags = 0;
+        (void)sigaltstack(&Stack, NULL);
+
+        memset(&Action, 0, sizeof(Action));
+        Action.sa_flags = SA_SIGINFO | SA_ONSTACK;
+        Action.sa_sigaction = Sim_FaultHandler;
+        (void)sigaction(SIGSEGV, &Action, NULL);
+        Action.sa_sigaction = Sim_TrapHandler;
+        (void)sigaction(SIGTRAP, &Action, NULL);
+
+        Sim_Initialized = TRUE;
+
+        /* Cost of an empty count */
+        Sim_StartInstructionCount();
+        Sim_Count_Overhead = Sim_StopInstructionCount();
+    }
+    Sim_Reset();
+}
+
+/*********************************************************************************************/
+void Sim_Reset(void)
+{
+    uint8 Port;
+    uint32 *Regs;
+
+    memset(Sim_Periph_Regs, 0, sizeof(Sim_Periph_Regs));
+    memset(Sim_Ppb_Regs, 0, sizeof(Sim_Ppb_Regs));
+
+    for(Port = 0; Port < SIM_GPIO_PORTS_NUMBER; Port++)
+    {
+        Regs = Sim_GpioRegs(Port);
+        Regs[SIM_GPIO_CR / 4U] = 0xFFU & ~Sim_Gpio_Protected_Pins[Port];
+        Sim_Gpio_Data[Port] = 0U;
+        Sim_Gpio_Inputs[Port] = 0U;
+        Sim_Gpio_Locked[Port] = TRUE;
+        Sim_Prgpio_Polls[Port] = 0U;
+    }
+
+    /* PC0-PC3 are the JTAG pins after reset */
+    Regs = Sim_GpioRegs(2U);
+    Regs[SIM_GPIO_AFSEL / 4U] = 0x0FU;
+    Regs[SIM_GPIO_DEN / 4U]   = 0x0FU;
+    Regs[SIM_GPIO_PUR / 4U]   = 0x0FU;
+    Regs[SIM_GPIO_PCTL / 4U]  = 0x00001111U;
+
+    *Sim_Storage(SIM_SYSCTL_BASE + SIM_SYSCTL_RCC)  = SIM_RCC_RESET;
+    *Sim_Storage(SIM_SYSCTL_BASE + SIM_SYSCTL_RCC2) = SIM_RCC2_RESET;
+
+    Sim_Prgpio_Delay = 0U;
+    Sim_Access_Hook = NULL_PTR;
+    Sim_ResetCounters();
+}
+
+/*********************************************************************************************/
+void Sim_ResetCounters(void)
+{
+    memset(&Sim_Counters, 0, sizeof(Sim_Counters));
+    Sim_Trace_Count = 0U;
+}
+
+/*********************************************************************************************/
+void Sim_GetCounters(Sim_CountersType *Counters_Ptr)
+{
+    *Counters_Ptr = Sim_Counters;
+}
+
+/*********************************************************************************************/
+uint32 Sim_GetTraceCount(void)
+{
+    return Sim_Trace_Count;
+}
+
+/*********************************************************************************************/
+Std_ReturnType Sim_GetTrace(uint32 Index, Sim_TraceType *Access_Ptr)
+{
+    if((Index >= Sim_Trace_Count) || ((Sim_Trace_Count - Index) > SIM_TRACE_SIZE))
+    {
+        return E_NOT_OK;
+    }
+    *Access_Ptr = Sim_Trace[Index % SIM_TRACE_SIZE];
+    return E_OK;
+}
+
+/*********************************************************************************************/
+void Sim_SetAccessHook(Sim_AccessHookType Hook)
+{
+    Sim_Access_Hook = Hook;
+}
+
+/*********************************************************************************************/
+uint32 Sim_Peek(uint32 Address)
+{
+    return Sim_ReadReg(Address & ~3U, FALSE);
+}
+
+/*********************************************************************************************/
+void Sim_Poke(uint32 Address, uint32 Value)
+{
+    boolean Ahb;
+    uint32 Offset;
+    uint8 Port = Sim_GpioPort(Address, &Ahb, &Offset);
+
+    if((Port < SIM_GPIO_PORTS_NUMBER) && (Offset < SIM_GPIO_DATA_END))
+    {
+        uint8 Lanes = (uint8)((Offset >> 2) & 0xFFU);
+        Sim_Gpio_Data[Port] = (uint8)((Sim_Gpio_Data[Port] & ~Lanes) | (Value & Lanes));
+    }
+    else
+    {
+        *Sim_Storage(Address & ~3U) = Value;
+    }
+}
+
+/*********************************************************************************************/
+void Sim_SetPrgpioDelay(uint32 Polls)
+{
+    Sim_Prgpio_Delay = Polls;
+}
+
+/*********************************************************************************************/
+void Sim_DriveInputs(uint8 Port, uint8 Pins, uint8 Levels)
+{
+    uint32 *Regs = Sim_GpioRegs(Port);
+    uint8 Old = Sim_Gpio_Inputs[Port];
+    uint8 New = (uint8)((Old & ~Pins) | (Levels & Pins));
+    uint32 Inputs = Regs[SIM_GPIO_DEN / 4U] & ~Regs[SIM_GPIO_DIR / 4U];
+    uint32 Is = Regs[SIM_GPIO_IS / 4U];
+    uint32 Ibe = Regs[SIM_GPIO_IBE / 4U];
+    uint32 Iev = Regs[SIM_GPIO_IEV / 4U];
+    uint32 Changed = (uint32)(Old ^ New);
+    uint32 Edges;
+    uint32 Levels_Hit;
+
+    Sim_Gpio_Inputs[Port] = New;
+
+    /* Edge sensitive pins: both edges (IBE) or the edge selected by IEV */
+    Edges = (Ibe & Changed) | (~Ibe & Iev & Changed & New) | (~Ibe & ~Iev & Changed & ~(uint32)New);
+    /* Level sensitive pins: the level selected by IEV */
+    Levels_Hit = (Iev & New) | (~Iev & ~(uint32)New);
+
+    Regs[SIM_GPIO_RIS / 4U] |= ((Edges & ~Is) | (Levels_Hit & Is)) & Inputs & 0xFFU;
+}
+
+/*********************************************************************************************/
+uint8 Sim_GetPinLevels(uint8 Port)
+{
+    return Sim_PinLevels(Port);
+}
+
+/*********************************************************************************************/
+boolean Sim_IsGpioIrqPending(uint8 Port)
+{
+    uint32 *Regs = Sim_GpioRegs(Port);
+    uint8 Irq = Sim_Gpio_Irq[Port];
+    uint32 Enabled = Sim_Ppb_Regs[(SIM_NVIC_EN0 / 4U) + (Irq / 32U)] & (1U << (Irq % 32U));
+
+    return (((Regs[SIM_GPIO_RIS / 4U] & Regs[SIM_GPIO_IM / 4U]) != 0U) && (Enabled != 0U)) ? TRUE : FALSE;
+}
+
+/*********************************************************************************************/
+void Sim_StartInstructionCount(void)
+{
+    Sim_Instructions = 0U;
+    Sim_Stepping = 1;
+    (void)raise(SIGTRAP);
+}
+
+/*********************************************************************************************/
+uint32 Sim_StopInstructionCount(void)
+{
+    Sim_Stepping = 0;
+    return (Sim_Instructions > Sim_Count_Overhead) ? (Sim_Instructions - Sim_Count_Overhead) : 0U;
+}
@@ -0,0 +1,124 @@
+ /******************************************************************************
+ *
+ * Module: Sim
+ *
+ * File Name: Sim.h
+ *
+ * Description: Header file for the host simulation of the TM4C123GH6PM GPIO,
+ *              system control and private peripheral bus registers.
+ *
+ * Author: Tarek Emad
+ ******************************************************************************/
+
+#ifndef SIM_H
+#define SIM_H
+
+#include "Std_Types.h"
+
+/*
+ * The drivers are compiled for the host unchanged: the register addresses they use are
+ * mapped at the same host addresses without any access right, every access faults into
+ * the simulator which loads the modelled value, single-steps the access then applies the
+ * written value to the register file with the semantics of the device:
+ * - GPIOLOCK/GPIOCR: GPIOCR is only writable after the unlock key, the GPIOCR bits of the
+ *   protected pins (PC0-PC3, PD7, PF0) gate the writes to GPIOAFSEL, GPIOPUR, GPIOPDR and GPIODEN
+ * - GPIODATA: bits [9:2] of the address select the lanes seen by the access
+ * - RCGCGPIO/PRGPIO: a port stays not ready for Sim_SetPrgpioDelay reads of PRGPIO after its
+ *   clock is enabled, an access to a port that is not ready is a bus fault on the device and is counted
+ * - GPIOHBCTL: each port answers on its AHB or APB aperture only, the other one is counted
+ * - RIS/IM/MIS/ICR of the GPIO interrupts, driven by Sim_DriveInputs
+ * - RCC/RCC2 writes are logged, PLLLRIS is set once the PLL is powered
+ * - SysTick CTRL COUNTFLAG (cleared by a read), CURRENT (cleared by a write)
+ * - ICSR PENDSVSET/PENDSVCLR, NVIC EN0-EN4/DIS0-DIS4
+ * - the bit-band alias of the peripheral region
+ * Any other register is plain storage.
+ */
+
+/* Unlock key of GPIOLOCK */
+#define SIM_GPIO_UNLOCK_KEY         (0x4C4F434BU)
+
+/* Modelled bus cycles of one access on each bus (no wait state on AHB and on the PPB) */
+#define SIM_APB_ACCESS_CYCLES       (2U)
+#define SIM_AHB_ACCESS_CYCLES       (1U)
+#define SIM_PPB_ACCESS_CYCLES       (1U)
+
+/* Number of the entries kept in the access trace, the oldest ones are overwritten */
+#define SIM_TRACE_SIZE              (512U)
+
+/* Number of the GPIO ports (PORTA .. PORTF) */
+#define SIM_GPIO_PORTS_NUMBER       (6U)
+
+/* Register accesses counted since the last Sim_ResetCounters */
+typedef struct
+{
+    uint32 Reads;                /* Register reads */
+    uint32 Writes;               /* Register writes */
+    uint32 Bus_Cycles;           /* Modelled bus cycles of all the accesses */
+    uint32 Gpio_Apb_Accesses;    /* Accesses to the GPIO APB apertures */
+    uint32 Gpio_Ahb_Accesses;    /* Accesses to the GPIO AHB apertures */
+    uint32 Sysctl_Accesses;      /* Accesses to the system control registers */
+    uint32 Ppb_Accesses;         /* Accesses to the private peripheral bus (SysTick, NVIC, SCB) */
+    uint32 Bitband_Accesses;     /* Accesses through the bit-band alias */
+    uint32 Lock_Violations;      /* Writes to a locked GPIOCR, dropped */
+    uint32 Commit_Violations;    /* Changes of uncommitted GPIOAFSEL/PUR/PDR/DEN bits, dropped */
+    uint32 Clock_Violations;     /* GPIO accesses to a port not ready in PRGPIO */
+    uint32 Aperture_Violations;  /* GPIO accesses to the aperture not selected by GPIOHBCTL */
+} Sim_CountersType;
+
+/* One register access of the trace */
+typedef struct
+{
+    uint32  Address;
+    uint32  Value;   /* Value read or written by the access */
+    boolean Write;
+} Sim_TraceType;
+
+/* Called after each register access */
+typedef void (*Sim_AccessHookType)(const Sim_TraceType *Access);
+
+/* Map the register windows and install the fault handlers, then reset the device */
+void Sim_Init(void);
+
+/* Restore the reset value of every register, clear the counters and the trace */
+void Sim_Reset(void);
+
+/* Clear the counters and the trace */
+void Sim_ResetCounters(void);
+
+/* Copy the counters */
+void Sim_GetCounters(Sim_CountersType *Counters_Ptr);
+
+/* Number of the accesses recorded in the trace since the last reset (may exceed SIM_TRACE_SIZE) */
+uint32 Sim_GetTraceCount(void);
+
+/* Access number Index of the trace, E_NOT_OK if it was overwritten or does not exist */
+Std_ReturnType Sim_GetTrace(uint32 Index, Sim_TraceType *Access_Ptr);
+
+/* Install a hook called after each register access, NULL_PTR to remove it */
+void Sim_SetAccessHook(Sim_AccessHookType Hook);
+
+/* Read or write the modelled value of a register without any side effect and without counting */
+uint32 Sim_Peek(uint32 Address);
+void Sim_Poke(uint32 Address, uint32 Value);
+
+/* Number of PRGPIO reads that still see a port not ready after its clock is enabled (0 after Sim_Reset) */
+void Sim_SetPrgpioDelay(uint32 Polls);
+
+/* Drive the level of the input pins in Pins of Port, the edges latch the GPIO interrupts */
+void Sim_DriveInputs(uint8 Port, uint8 Pins, uint8 Levels);
+
+/* Level of each pin of Port, the output latch for the outputs and the driven level for the inputs */
+uint8 Sim_GetPinLevels(uint8 Port);
+
+/* TRUE if the GPIO interrupt of Port is latched (MIS != 0) and enabled in the NVIC */
+boolean Sim_IsGpioIrqPending(uint8 Port);
+
+/*
+ * Count the host instructions executed between the two calls by single-stepping them,
+ * the cost of the calls themselves is removed. Used to compare two code paths on the host,
+ * not as a figure of the target.
+ */
+void Sim_StartInstructionCount(void);
+uint32 Sim_StopInstructionCount(void);
+
+#endif /* SIM_H */
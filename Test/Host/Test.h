@@ -0,0 +1,54 @@
+ /******************************************************************************
+ *
+ * Module: Test
+ *
+ * File Name: Test.h
+ *
+ * Description: Minimal checks and runner of the host unit tests and benchmarks.
+ *
+ * Author: Tarek Emad
+ ******************************************************************************/
+
+#ifndef TEST_H
+#define TEST_H
+
+#include <stdio.h>
+#include "Std_Types.h"
+
+/* Number of the failed checks of the test program */
+static uint32 Test_Failures = 0;
+
+/* Check a condition, a failure is reported and the test goes on */
+#define TEST_CHECK(COND) \
+    do { \
+        if(!(COND)) \
+        { \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #COND); \
+            Test_Failures++; \
+        } \
+    } while(0)
+
+/* Check that two unsigned values are equal and report both if they are not */
+#define TEST_CHECK_EQUAL(EXPECTED, ACTUAL) \
+    do { \
+        unsigned long Test_Expected = (unsigned long)(EXPECTED); \
+        unsigned long Test_Actual = (unsigned long)(ACTUAL); \
+        if(Test_Expected != Test_Actual) \
+        { \
+            printf("%s:%d: check failed: %s == %s (0x%lX != 0x%lX)\n", __FILE__, __LINE__, #EXPECTED, #ACTUAL, Test_Expected, Test_Actual); \
+            Test_Failures++; \
+        } \
+    } while(0)
+
+/* Run one test function */
+#define TEST_RUN(FUNC) \
+    do { \
+        printf("[ RUN  ] %s\n", #FUNC); \
+        FUNC(); \
+    } while(0)
+
+/* Exit status of the test program */
+#define TEST_RESULT() \
+    ((Test_Failures == 0U) ? (printf("[ PASS ]\n"), 0) : (printf("[ FAIL ] %lu failed checks\n", (unsigned long)Test_Failures), 1))
+
+#endif /* TEST_H */
@@ -0,0 +1,264 @@
+ /******************************************************************************
+ *
+ * Module: Test
+ *
+ * File Name: Test_ButtonDebounce.c
+ *
+ * Description: Unit tests of the whole port debouncer (Button_RefreshPorts): the vertical
+ *              counter against a per-lane counter on bouncing samples, its edges and its masks.
+ *
+ * Author: Tarek Emad
+ ******************************************************************************/
+
+/* All the lanes of PORTB and the low half of PORTE */
+#define BUTTON_DEBOUNCED_PORTS_LIST(BUTTON_PORT) \
+    BUTTON_PORT(PortB, 1U, 0xFFU) \
+    BUTTON_PORT(PortE, 4U, 0x0FU)
+
+#include "Button.c"
+#include "Test.h"
+#include "Sim.h"
+
+/* GPIO clock, ready and aperture registers */
+#define TEST_RCGCGPIO           (0x400FE608U)
+#define TEST_PRGPIO             (0x400FEA08U)
+#define TEST_GPIOHBCTL          (0x400FE06CU)
+
+/* GPIODEN of PORTB and PORTE (APB aperture) */
+#define TEST_PORTB_DEN          (0x4000551CU)
+#define TEST_PORTE_DEN          (0x4002451CU)
+
+#define TEST_PORTB              (1U)
+#define TEST_PORTE              (4U)
+
+/* Number of samples of the bouncing sequence */
+#define TEST_SAMPLES            (2000U)
+
+/* Debounce state of one lane as a per-lane implementation would keep it */
+typedef struct
+{
+    uint8 Level;    /* Debounced level */
+    uint8 Count;    /* Consecutive samples different from Level */
+} Test_LaneType;
+
+static Test_LaneType Test_Lanes[8];
+
+/* Pseudo random sequence, the same at every run */
+static uint32 Test_Random_State = 1U;
+
+static uint32 Test_Random(void)
+{
+    Test_Random_State = (Test_Random_State * 1103515245U) + 12345U;
+    return Test_Random_State >> 16;
+}
+
+/* Enable PORTB and PORTE with all their pins digital inputs, all the buttons released */
+static void Test_Reset(void)
+{
+    uint8 Lane;
+
+    Sim_Reset();
+    Sim_Poke(TEST_RCGCGPIO, (1U << TEST_PORTB) | (1U << TEST_PORTE));
+    Sim_Poke(TEST_PRGPIO, (1U << TEST_PORTB) | (1U << TEST_PORTE));
+    Sim_Poke(TEST_GPIOHBCTL, DIO_AHB_PORTS_MASK);
+    Sim_Poke(TEST_PORTB_DEN, 0xFFU);
+    Sim_Poke(TEST_PORTE_DEN, 0xFFU);
+    Sim_DriveInputs(TEST_PORTB, 0xFFU, BUTTON_RELEASED_LEVELS);
+    Sim_DriveInputs(TEST_PORTE, 0xFFU, BUTTON_RELEASED_LEVELS);
+
+    for(Lane = 0; Lane < 8U; Lane++)
+    {
+        Test_Lanes[Lane].Level = (uint8)(BUTTON_RELEASED_LEVELS & 1U);
+        Test_Lanes[Lane].Count = 0;
+    }
+    for(Lane = 0; Lane < BUTTON_PORT_ID_INVALID; Lane++)
+    {
+        g_Button_Ports[Lane] = (Button_PortDebounceType){BUTTON_RELEASED_LEVELS, 0, 0, 0, 0};
+    }
+}
+
+/* Reference debouncer of one lane, returns TRUE if the lane changes its state */
+static boolean Test_RefreshLane(Test_LaneType *Lane_Ptr, uint8 Sample)
+{
+    boolean Changed = FALSE;
+
+    if(Sample == Lane_Ptr->Level)
+    {
+        Lane_Ptr->Count = 0;
+    }
+    else
+    {
+        Lane_Ptr->Count++;
+        if(Lane_Ptr->Count == BUTTON_DEBOUNCE_SAMPLES)
+        {
+            Lane_Ptr->Level = Sample;
+            Lane_Ptr->Count = 0;
+            Changed = TRUE;
+        }
+    }
+    return Changed;
+}
+
+/*
+ * Bouncing samples on the 8 lanes of PORTB: each lane moves to a new level now and then and
+ * bounces for a few samples around each move, the state and the edges of every lane after each
+ * refresh are the ones of a per-lane counter, and each refresh reads each port once
+ */
+static void Test_MatchesPerLaneCounter(void)
+{
+    uint32 Sample;
+    uint8 Lane;
+    uint8 Levels = BUTTON_RELEASED_LEVELS;
+    uint8 Bounce[8] = {0};
+    uint8 Port_Levels;
+    uint8 Expected_Pressed;
+    uint8 Expected_Edges_Pressed;
+    uint8 Expected_Edges_Released;
+    uint8 Pressed;
+    uint8 Released;
+    uint8 Edge_Lanes = 0;
+    Sim_CountersType Counters;
+
+    Test_Reset();
+    Test_Random_State = 1U;
+
+    for(Sample = 0; Sample < TEST_SAMPLES; Sample++)
+    {
+        Port_Levels = 0;
+        Expected_Pressed = 0;
+        Expected_Edges_Pressed = 0;
+        Expected_Edges_Released = 0;
+        for(Lane = 0; Lane < 8U; Lane++)
+        {
+            if(Bounce[Lane] > 0U)
+            {
+                /* Contact bounce: random level for a few samples */
+                Bounce[Lane]--;
+                Port_Levels |= (uint8)((Test_Random() & 1U) << Lane);
+            }
+            else
+            {
+                if((Test_Random() % 16U) == 0U)
+                {
+                    /* The lane moves to the other level after up to 4 bouncing samples */
+                    Levels ^= (uint8)(1U << Lane);
+                    Bounce[Lane] = (uint8)(Test_Random() % 5U);
+                }
+                Port_Levels |= (uint8)(Levels & (1U << Lane));
+            }
+        }
+
+        Sim_DriveInputs(TEST_PORTB, 0xFFU, Port_Levels);
+        Sim_ResetCounters();
+        Button_RefreshPorts();
+        Sim_GetCounters(&Counters);
+        TEST_CHECK_EQUAL(BUTTON_PORT_ID_INVALID, Counters.Reads);
+        TEST_CHECK_EQUAL(0U, Counters.Writes);
+        TEST_CHECK_EQUAL(0U, Counters.Clock_Violations + Counters.Aperture_Violations);
+
+        for(Lane = 0; Lane < 8U; Lane++)
+        {
+            if(Test_RefreshLane(&Test_Lanes[Lane], (uint8)((Port_Levels >> Lane) & 1U)) == TRUE)
+            {
+                if(Test_Lanes[Lane].Level == (BUTTON_PRESSED & 1U))
+                {
+                    Expected_Edges_Pressed |= (uint8)(1U << Lane);
+                }
+                else
+                {
+                    Expected_Edges_Released |= (uint8)(1U << Lane);
+                }
+            }
+            if(Test_Lanes[Lane].Level == (BUTTON_PRESSED & 1U))
+            {
+                Expected_Pressed |= (uint8)(1U << Lane);
+            }
+        }
+
+        Button_GetPortEdges(BUTTON_PORT_ID_PortB, &Pressed, &Released);
+        TEST_CHECK_EQUAL(Expected_Pressed, Button_GetPortState(BUTTON_PORT_ID_PortB));
+        TEST_CHECK_EQUAL(Expected_Edges_Pressed, Pressed);
+        TEST_CHECK_EQUAL(Expected_Edges_Released, Released);
+        Edge_Lanes |= (uint8)(Expected_Edges_Pressed | Expected_Edges_Released);
+    }
+
+    /* Every lane of the sequence changed its state */
+    TEST_CHECK_EQUAL(0xFFU, Edge_Lanes);
+}
+
+/* A press debounced after BUTTON_DEBOUNCE_SAMPLES samples, its edge reported by that refresh only */
+static void Test_PressAfterSamples(void)
+{
+    uint8 Pressed;
+    uint8 Released;
+    uint8 Sample;
+    uint8 Lane_Mask = 0x04U;
+    uint8 Pressed_Levels = (uint8)(BUTTON_RELEASED_LEVELS ^ Lane_Mask);
+
+    Test_Reset();
+
+    /* Bounce: pressed, released, then pressed for good */
+    Sim_DriveInputs(TEST_PORTB, 0xFFU, Pressed_Levels);
+    Button_RefreshPorts();
+    Sim_DriveInputs(TEST_PORTB, 0xFFU, BUTTON_RELEASED_LEVELS);
+    Button_RefreshPorts();
+    TEST_CHECK_EQUAL(0U, Button_GetPortState(BUTTON_PORT_ID_PortB));
+
+    Sim_DriveInputs(TEST_PORTB, 0xFFU, Pressed_Levels);
+    for(Sample = 1U; Sample < BUTTON_DEBOUNCE_SAMPLES; Sample++)
+    {
+        Button_RefreshPorts();
+        Button_GetPortEdges(BUTTON_PORT_ID_PortB, &Pressed, &Released);
+        TEST_CHECK_EQUAL(0U, Button_GetPortState(BUTTON_PORT_ID_PortB));
+        TEST_CHECK_EQUAL(0U, Pressed);
+    }
+
+    Button_RefreshPorts();
+    Button_GetPortEdges(BUTTON_PORT_ID_PortB, &Pressed, &Released);
+    TEST_CHECK_EQUAL(Lane_Mask, Button_GetPortState(BUTTON_PORT_ID_PortB));
+    TEST_CHECK_EQUAL(Lane_Mask, Pressed);
+    TEST_CHECK_EQUAL(0U, Released);
+
+    Button_RefreshPorts();
+    Button_GetPortEdges(BUTTON_PORT_ID_PortB, &Pressed, &Released);
+    TEST_CHECK_EQUAL(Lane_Mask, Button_GetPortState(BUTTON_PORT_ID_PortB));
+    TEST_CHECK_EQUAL(0U, Pressed);
+    TEST_CHECK_EQUAL(0U, Released);
+}
+
+/* The lanes out of the mask of a port never change, the other ports are debounced on their own */
+static void Test_LaneMask(void)
+{
+    uint8 Pressed;
+    uint8 Released;
+    uint8 Sample;
+
+    Test_Reset();
+    Sim_DriveInputs(TEST_PORTE, 0xFFU, (uint8)~BUTTON_RELEASED_LEVELS);
+    for(Sample = 0; Sample < BUTTON_DEBOUNCE_SAMPLES; Sample++)
+    {
+        Button_RefreshPorts();
+    }
+
+    Button_GetPortEdges(BUTTON_PORT_ID_PortE, &Pressed, &Released);
+    TEST_CHECK_EQUAL(0x0FU, Button_GetPortState(BUTTON_PORT_ID_PortE));
+    TEST_CHECK_EQUAL(0x0FU, Pressed);
+    TEST_CHECK_EQUAL(0U, Button_GetPortState(BUTTON_PORT_ID_PortB));
+
+    /* Invalid port and null pointers leave the outputs untouched */
+    Pressed = 0xAAU;
+    Button_GetPortEdges(BUTTON_PORT_ID_INVALID, &Pressed, &Released);
+    TEST_CHECK_EQUAL(0xAAU, Pressed);
+    TEST_CHECK_EQUAL(0U, Button_GetPortState(BUTTON_PORT_ID_INVALID));
+}
+
+int main(void)
+{
+    Sim_Init();
+
+    TEST_RUN(Test_MatchesPerLaneCounter);
+    TEST_RUN(Test_PressAfterSamples);
+    TEST_RUN(Test_LaneMask);
+
+    return TEST_RESULT();
+}
@@ -0,0 +1,217 @@
+ /******************************************************************************
+ *
+ * Module: Test
+ *
+ * File Name: Test_ButtonEdge.c
+ *
+ * Description: Integration test of the SW1 edge interrupt run in virtual time: the GPIO
+ *              interrupt releases Button_Task of App.c before the next tick, the next tick
+ *              confirms the edge and releases App_Task, a spike and the bounce edges inside
+ *              the lockout window change nothing. Built in the cooperative mode, with the
+ *              task profiler and in the preemptive mode.
+ *
+ * Author: Tarek Emad
+ ******************************************************************************/
+
+#include "Os_HostPort.c"
+#include "Test.h"
+#include "Dio.h"
+#include "Port.h"
+
+/* Step of the test run from the idle loop */
+typedef enum
+{
+    TEST_STEP_PRESS,    /* Edge of SW1 to its pressed level */
+    TEST_STEP_RELEASE,  /* Edge of SW1 to its released level */
+    TEST_STEP_TICK      /* End of the SysTick period */
+} Test_StepType;
+
+/* State seen by the idle loop once a step is handled */
+typedef struct
+{
+    uint8 Button_State;
+    boolean Led_Toggled;    /* LED level different from the one set by Init_Task */
+    uint32 Frame;
+} Test_SnapshotType;
+
+/* Maximum number of steps of a test */
+#define TEST_STEPS_MAX      (16U)
+
+/* SW1 and LED1 pins in PORTF */
+#define TEST_SW1_MASK       ((uint8)(1U << DioConf_SW1_CHANNEL_NUM))
+#define TEST_LED1_MASK      ((uint8)(1U << DioConf_LED1_CHANNEL_NUM))
+
+static const Test_StepType *Test_Steps = NULL_PTR;
+static uint32 Test_Steps_Count = 0;
+static uint32 Test_Step = 0;
+static Test_SnapshotType Test_Snapshots[TEST_STEPS_MAX];
+
+/* LED level set by Init_Task */
+static uint8 Test_Led_Initial_Level = STD_LOW;
+
+/* Level of the LED pin */
+static uint8 Test_GetLedLevel(void)
+{
+    return ((Sim_GetPinLevels(DioConf_LED1_PORT_NUM) & TEST_LED1_MASK) != 0U) ? STD_HIGH : STD_LOW;
+}
+
+/* Drive SW1, the edge raises the port interrupt once its notification is enabled */
+static void Test_DriveSw1(uint8 Level)
+{
+    Sim_DriveInputs(DioConf_SW1_PORT_NUM, TEST_SW1_MASK, (Level == STD_HIGH) ? TEST_SW1_MASK : 0U);
+    if(Sim_IsGpioIrqPending(DioConf_SW1_PORT_NUM) == TRUE)
+    {
+        Os_HostPort_RaiseInterrupt(GPIOPortF_Handler);
+    }
+}
+
+/* Each sleep of the idle loop records the state left by the previous step then runs the next step */
+static void Test_IdleHook(void)
+{
+    if(Test_Step == 0U)
+    {
+        Test_Led_Initial_Level = Test_GetLedLevel();
+    }
+    else
+    {
+        Test_Snapshots[Test_Step - 1U].Button_State = Button_GetState();
+        Test_Snapshots[Test_Step - 1U].Led_Toggled = (boolean)(Test_GetLedLevel() != Test_Led_Initial_Level);
+        Test_Snapshots[Test_Step - 1U].Frame = g_Frame_Counter;
+    }
+    if(Test_Step == Test_Steps_Count)
+    {
+        Os_HostPort_Stop();
+    }
+
+    switch(Test_Steps[Test_Step])
+    {
+        case TEST_STEP_PRESS:
+            Test_DriveSw1(BUTTON_PRESSED);
+            break;
+        case TEST_STEP_RELEASE:
+            Test_DriveSw1(BUTTON_RELEASED);
+            break;
+        default:
+            Os_HostPort_ExpireSysTick();
+            break;
+    }
+    Test_Step++;
+}
+
+/* Run the kernel and the application from Os_start through Count steps */
+static void Test_RunSteps(const Test_StepType *Steps, uint32 Count)
+{
+    Sim_Reset();
+    Sim_DriveInputs(DioConf_SW1_PORT_NUM, TEST_SW1_MASK, TEST_SW1_MASK); /* Released, pulled up */
+    Test_Steps = Steps;
+    Test_Steps_Count = Count;
+    Test_Step = 0;
+    Os_HostPort_SetIdleHook(Test_IdleHook);
+    Os_HostPort_Run(Os_start);
+}
+
+/*
+ * A press is armed by its edge and confirmed by the next tick, which toggles the LED. The bounce
+ * edges before the tick re-arm the press, the ones inside the lockout window (BUTTON_DEBOUNCE_SAMPLES
+ * ticks) after the press and after the release change neither the button state nor the LED, and
+ * the event releases are never counted as overruns
+ */
+static void Test_EdgeReleasesTasks(void)
+{
+    static const Test_StepType Steps[] = {
+        TEST_STEP_PRESS,                                    /* 0: press armed */
+        TEST_STEP_RELEASE, TEST_STEP_PRESS,                 /* 1, 2: bounce before the tick */
+        TEST_STEP_TICK,                                     /* 3: press confirmed */
+        TEST_STEP_RELEASE, TEST_STEP_PRESS,                 /* 4, 5: bounce in the lockout */
+        TEST_STEP_TICK, TEST_STEP_TICK, TEST_STEP_TICK,     /* 6 - 8: lockout over, still pressed */
+        TEST_STEP_RELEASE,                                  /* 9: release armed */
+        TEST_STEP_PRESS, TEST_STEP_RELEASE,                 /* 10, 11: bounce before the tick */
+        TEST_STEP_TICK,                                     /* 12: release confirmed */
+        TEST_STEP_PRESS, TEST_STEP_RELEASE                  /* 13, 14: bounce in the lockout */
+    };
+    static const Test_SnapshotType Expected[] = {
+        {BUTTON_RELEASED, FALSE, 0U},
+        {BUTTON_RELEASED, FALSE, 0U}, {BUTTON_RELEASED, FALSE, 0U},
+        {BUTTON_PRESSED,  TRUE,  1U},
+        {BUTTON_PRESSED,  TRUE,  1U}, {BUTTON_PRESSED,  TRUE,  1U},
+        {BUTTON_PRESSED,  TRUE,  2U}, {BUTTON_PRESSED,  TRUE,  3U}, {BUTTON_PRESSED,  TRUE,  4U},
+        {BUTTON_PRESSED,  TRUE,  4U},
+        {BUTTON_PRESSED,  TRUE,  4U}, {BUTTON_PRESSED,  TRUE,  4U},
+        {BUTTON_RELEASED, TRUE,  5U},
+        {BUTTON_RELEASED, TRUE,  5U}, {BUTTON_RELEASED, TRUE,  5U}
+    };
+    Os_OverloadStatsType Overload;
+#if (OS_TASK_PROFILING == STD_ON)
+    Os_TaskStatsType Stats;
+#endif
+    uint32 Index;
+
+    Test_RunSteps(Steps, sizeof(Steps) / sizeof(Steps[0]));
+
+    TEST_CHECK_EQUAL(sizeof(Steps) / sizeof(Steps[0]), Test_Step);
+    for(Index = 0; Index < (sizeof(Expected) / sizeof(Expected[0])); Index++)
+    {
+        TEST_CHECK_EQUAL(Expected[Index].Button_State, Test_Snapshots[Index].Button_State);
+        TEST_CHECK_EQUAL(Expected[Index].Led_Toggled, Test_Snapshots[Index].Led_Toggled);
+        TEST_CHECK_EQUAL(Expected[Index].Frame, Test_Snapshots[Index].Frame);
+    }
+
+    Os_GetOverloadStats(&Overload);
+    TEST_CHECK_EQUAL(0U, Overload.Overruns);
+    TEST_CHECK_EQUAL(0U, Overload.Late_Frames);
+
+#if (OS_TASK_PROFILING == STD_ON)
+    /* Only the frame releases are profiled: Button_Task at frames 1 to 5, App_Task at frame 3 */
+    TEST_CHECK(Os_GetTaskStats(OS_TASK_ID_Button_Task, &Stats) == E_OK);
+    TEST_CHECK_EQUAL(5U, Stats.Runs);
+    TEST_CHECK(Os_GetTaskStats(OS_TASK_ID_App_Task, &Stats) == E_OK);
+    TEST_CHECK_EQUAL(1U, Stats.Runs);
+#endif
+}
+
+/* Without a SW1 edge the tasks only run at their frames and nothing changes */
+static void Test_UntouchedButton(void)
+{
+    static const Test_StepType Steps[] = {
+        TEST_STEP_TICK, TEST_STEP_TICK
+    };
+
+    Test_RunSteps(Steps, sizeof(Steps) / sizeof(Steps[0]));
+
+    /* The SW1 interrupt is enabled by Init_Task, nothing is pending while the button is not touched */
+    TEST_CHECK_EQUAL(FALSE, Sim_IsGpioIrqPending(DioConf_SW1_PORT_NUM));
+    TEST_CHECK_EQUAL(BUTTON_RELEASED, Test_Snapshots[1].Button_State);
+    TEST_CHECK_EQUAL(FALSE, Test_Snapshots[1].Led_Toggled);
+    TEST_CHECK_EQUAL(2U, Test_Snapshots[1].Frame);
+}
+
+/* A spike on SW1 shorter than one tick, both edges notified, never registers as a press */
+static void Test_SingleSpike(void)
+{
+    static const Test_StepType Steps[] = {
+        TEST_STEP_PRESS, TEST_STEP_RELEASE,                 /* 0, 1: spike */
+        TEST_STEP_TICK, TEST_STEP_TICK, TEST_STEP_TICK      /* 2 - 4: released */
+    };
+    uint32 Index;
+
+    Test_RunSteps(Steps, sizeof(Steps) / sizeof(Steps[0]));
+
+    TEST_CHECK_EQUAL(sizeof(Steps) / sizeof(Steps[0]), Test_Step);
+    for(Index = 0; Index < (sizeof(Steps) / sizeof(Steps[0])); Index++)
+    {
+        TEST_CHECK_EQUAL(BUTTON_RELEASED, Test_Snapshots[Index].Button_State);
+        TEST_CHECK_EQUAL(FALSE, Test_Snapshots[Index].Led_Toggled);
+    }
+    TEST_CHECK_EQUAL(3U, Test_Snapshots[4].Frame);
+}
+
+int main(void)
+{
+    Sim_Init();
+
+    TEST_RUN(Test_UntouchedButton);
+    TEST_RUN(Test_EdgeReleasesTasks);
+    TEST_RUN(Test_SingleSpike);
+
+    return TEST_RESULT();
+}
@@ -0,0 +1,130 @@
+ /******************************************************************************
+ *
+ * Module: Test
+ *
+ * File Name: Test_Mcu.c
+ *
+ * Description: Unit tests of the clock setup: the RCC/RCC2 write sequence of Mcu_Init
+ *              and the SysTick reload at the resulting core clock.
+ *
+ * Author: Tarek Emad
+ ******************************************************************************/
+
+#include "Test.h"
+#include "Sim.h"
+#include "Mcu.h"
+#include "Gpt.h"
+#include "tm4c123gh6pm_registers.h"
+
+#define TEST_RCC_ADDRESS            (0x400FE060U)
+#define TEST_RCC2_ADDRESS           (0x400FE070U)
+#define TEST_RIS_ADDRESS            (0x400FE050U)
+
+#define TEST_RCC_XTAL_MASK          (0x000007C0U)
+#define TEST_RCC_MOSCDIS_MASK       (0x00000001U)
+#define TEST_RCC_USESYSDIV_MASK     (0x00400000U)
+#define TEST_RCC2_OSCSRC2_MASK      (0x00000070U)
+#define TEST_RCC2_BYPASS2_MASK      (0x00000800U)
+#define TEST_RCC2_PWRDN2_MASK       (0x00002000U)
+#define TEST_RCC2_SYSDIV2_MASK      (0x1FC00000U)
+#define TEST_RCC2_DIV400_MASK       (0x40000000U)
+#define TEST_RCC2_USERCC2_MASK      (0x80000000U)
+#define TEST_RIS_PLLLRIS_MASK       (0x00000040U)
+
+/* RCC2 fields that change the PLL or the divisor, they may only change while the PLL is bypassed */
+#define TEST_RCC2_PLL_FIELDS        (TEST_RCC2_OSCSRC2_MASK | TEST_RCC2_PWRDN2_MASK | TEST_RCC2_SYSDIV2_MASK | TEST_RCC2_DIV400_MASK)
+
+/*
+ * Mcu_Init must take RCC2 over and bypass the PLL before it touches the oscillator, the PLL or
+ * the divisor, and only drive the system clock from the PLL once RIS reports it locked
+ */
+static void Test_RccSequence(void)
+{
+    Sim_TraceType Access;
+    Sim_CountersType Counters;
+    uint32 Index;
+    uint32 Rcc2 = 0x07C06810U; /* Reset value */
+    boolean Locked = FALSE;
+    uint32 Bypass_Cleared = 0U;
+    uint32 Rcc2_Writes = 0U;
+
+    Sim_Reset();
+    Mcu_Init();
+
+    for(Index = 0U; Sim_GetTrace(Index, &Access) == E_OK; Index++)
+    {
+        if((Access.Address == TEST_RIS_ADDRESS) && (Access.Write == FALSE))
+        {
+            if((Access.Value & TEST_RIS_PLLLRIS_MASK) != 0U)
+            {
+                Locked = TRUE;
+            }
+        }
+        else if((Access.Address == TEST_RCC2_ADDRESS) && (Access.Write == TRUE))
+        {
+            Rcc2_Writes++;
+            /* RCC2 is in use from its first write */
+            TEST_CHECK((Access.Value & TEST_RCC2_USERCC2_MASK) != 0U);
+            if(((Access.Value ^ Rcc2) & TEST_RCC2_PLL_FIELDS) != 0U)
+            {
+                TEST_CHECK((Rcc2 & TEST_RCC2_BYPASS2_MASK) != 0U);
+                TEST_CHECK((Access.Value & TEST_RCC2_BYPASS2_MASK) != 0U);
+            }
+            if(((Rcc2 & TEST_RCC2_BYPASS2_MASK) != 0U) && ((Access.Value & TEST_RCC2_BYPASS2_MASK) == 0U))
+            {
+                TEST_CHECK(Locked == TRUE);
+                Bypass_Cleared++;
+            }
+            Rcc2 = Access.Value;
+        }
+        else if((Access.Address == TEST_RCC_ADDRESS) && (Access.Write == TRUE))
+        {
+            /* The RCC crystal field is only changed with RCC2 in use and the PLL bypassed */
+            TEST_CHECK((Rcc2 & TEST_RCC2_USERCC2_MASK) != 0U);
+            TEST_CHECK((Rcc2 & TEST_RCC2_BYPASS2_MASK) != 0U);
+        }
+    }
+
+    TEST_CHECK_EQUAL(1U, Bypass_Cleared);
+    TEST_CHECK_EQUAL(7U, Rcc2_Writes);
+
+    /* Final clock configuration: 16 MHz crystal on the main oscillator, 400 MHz / 5 */
+    TEST_CHECK_EQUAL(0U, SYSCTL_RCC2_REG & (TEST_RCC2_OSCSRC2_MASK | TEST_RCC2_PWRDN2_MASK | TEST_RCC2_BYPASS2_MASK));
+    TEST_CHECK_EQUAL(TEST_RCC2_USERCC2_MASK | TEST_RCC2_DIV400_MASK, SYSCTL_RCC2_REG & (TEST_RCC2_USERCC2_MASK | TEST_RCC2_DIV400_MASK));
+    TEST_CHECK_EQUAL(4U, (SYSCTL_RCC2_REG & TEST_RCC2_SYSDIV2_MASK) >> 22);
+    TEST_CHECK_EQUAL(0x15U << 6, SYSCTL_RCC_REG & TEST_RCC_XTAL_MASK);
+    TEST_CHECK_EQUAL(0U, SYSCTL_RCC_REG & TEST_RCC_MOSCDIS_MASK);
+    TEST_CHECK(0U != (SYSCTL_RCC_REG & TEST_RCC_USESYSDIV_MASK));
+    TEST_CHECK_EQUAL(80000000U, Mcu_GetCoreFrequency());
+
+    Sim_GetCounters(&Counters);
+    TEST_CHECK_EQUAL(0U, Counters.Clock_Violations);
+}
+
+/* The reload counts the period at the core clock, a period the 24-bit counter can not count is limited */
+static void Test_SysTickStart(void)
+{
+    Sim_Reset();
+    Mcu_Init();
+
+    SysTick_Start(20U);
+    TEST_CHECK_EQUAL(1600000U - 1U, SYSTICK_RELOAD_REG);
+    TEST_CHECK_EQUAL(0x07U, SYSTICK_CTRL_REG & 0x07U);
+
+    TEST_CHECK_EQUAL(209U, SysTick_GetMaxPeriod());
+    SysTick_Start(209U);
+    TEST_CHECK_EQUAL((209U * 80000U) - 1U, SYSTICK_RELOAD_REG);
+    SysTick_Start(70000U);
+    TEST_CHECK_EQUAL((209U * 80000U) - 1U, SYSTICK_RELOAD_REG);
+    TEST_CHECK(SYSTICK_RELOAD_REG <= 0x00FFFFFFU);
+}
+
+int main(void)
+{
+    Sim_Init();
+
+    TEST_RUN(Test_RccSequence);
+    TEST_RUN(Test_SysTickStart);
+
+    return TEST_RESULT();
+}
@@ -0,0 +1,176 @@
+ /******************************************************************************
+ *
+ * Module: Test
+ *
+ * File Name: Test_Os.c
+ *
+ * Description: Unit tests of the cyclic executive run in virtual time: the schedule
+ *              generated from the task table against the hand-written switch it replaced.
+ *
+ * Author: Tarek Emad
+ ******************************************************************************/
+
+#include "Os_HostPort.c"
+#include "Test.h"
+
+/* Maximum number of task runs logged by a test */
+#define TEST_LOG_SIZE       (128U)
+
+/* One task run: the task and the number of the frame it ran in */
+typedef struct
+{
+    Os_TaskIdType Task;
+    uint32 Frame;
+} Test_RunType;
+
+static Test_RunType Test_Log[TEST_LOG_SIZE];
+static uint32 Test_Log_Count = 0;
+
+/* Number of SysTick periods still to expire before the kernel is stopped */
+static uint32 Test_Ticks_Left = 0;
+
+static void Test_LogRun(Os_TaskIdType Task, uint32 Frame)
+{
+    if(Test_Log_Count < TEST_LOG_SIZE)
+    {
+        Test_Log[Test_Log_Count].Task = Task;
+        Test_Log[Test_Log_Count].Frame = Frame;
+        Test_Log_Count++;
+    }
+}
+
+/* Tasks of the table, they only log their run */
+void Init_Task(void)
+{
+    Mcu_Init();
+}
+
+void Button_Task(void)
+{
+    Test_LogRun(OS_TASK_ID_Button_Task, g_Frame_Counter);
+}
+
+void App_Task(void)
+{
+    Test_LogRun(OS_TASK_ID_App_Task, g_Frame_Counter);
+}
+
+void Led_Task(void)
+{
+    Test_LogRun(OS_TASK_ID_Led_Task, g_Frame_Counter);
+}
+
+/* Each sleep of the idle loop lasts until the end of the SysTick period */
+static void Test_IdleHook(void)
+{
+    if(Test_Ticks_Left == 0U)
+    {
+        Os_HostPort_Stop();
+    }
+    Test_Ticks_Left--;
+    Os_HostPort_ExpireSysTick();
+}
+
+/* Run the kernel from Os_start for Ticks SysTick periods */
+static void Test_RunOs(uint32 Ticks)
+{
+    Sim_Reset();
+    Test_Log_Count = 0;
+    Test_Ticks_Left = Ticks;
+    Os_HostPort_SetIdleHook(Test_IdleHook);
+    Os_HostPort_Run(Os_start);
+}
+
+/* Legacy Os_Scheduler switch replaced by the task table, it logs the calls of one tick */
+static void Test_LegacyScheduler(uint8 *Tick_Count_Ptr, uint32 Frame, Test_RunType *Log_Ptr, uint32 *Count_Ptr)
+{
+    *Tick_Count_Ptr += OS_BASE_TIME;
+    switch(*Tick_Count_Ptr)
+    {
+        case 20:
+        case 100:
+            Log_Ptr[(*Count_Ptr)++] = (Test_RunType){OS_TASK_ID_Button_Task, Frame};
+            break;
+        case 40:
+        case 80:
+            Log_Ptr[(*Count_Ptr)++] = (Test_RunType){OS_TASK_ID_Button_Task, Frame};
+            Log_Ptr[(*Count_Ptr)++] = (Test_RunType){OS_TASK_ID_Led_Task, Frame};
+            break;
+        case 60:
+            Log_Ptr[(*Count_Ptr)++] = (Test_RunType){OS_TASK_ID_Button_Task, Frame};
+            Log_Ptr[(*Count_Ptr)++] = (Test_RunType){OS_TASK_ID_App_Task, Frame};
+            break;
+        case 120:
+            Log_Ptr[(*Count_Ptr)++] = (Test_RunType){OS_TASK_ID_Button_Task, Frame};
+            Log_Ptr[(*Count_Ptr)++] = (Test_RunType){OS_TASK_ID_App_Task, Frame};
+            Log_Ptr[(*Count_Ptr)++] = (Test_RunType){OS_TASK_ID_Led_Task, Frame};
+            *Tick_Count_Ptr = 0;
+            break;
+    }
+}
+
+/*
+ * The frames generated from the table release Button_Task, App_Task and Led_Task in the same
+ * frames and order as the 20/40/60/80/100/120 ms cases of the switch, over more than two major
+ * frames (past the 255 ms the uint8 tick count of the switch could hold)
+ */
+static void Test_ScheduleMatchesSwitch(void)
+{
+    Test_RunType Legacy[TEST_LOG_SIZE];
+    uint32 Legacy_Count = 0;
+    uint8 Tick_Count = 0;
+    uint32 Frame;
+    uint32 Run;
+    uint32 Legacy_Run = 0;
+
+    Test_RunOs(15U);
+    TEST_CHECK_EQUAL(15U, g_Frame_Counter);
+
+    for(Frame = 1U; Frame <= 15U; Frame++)
+    {
+        Test_LegacyScheduler(&Tick_Count, Frame, Legacy, &Legacy_Count);
+    }
+
+    for(Run = 0; Run < Test_Log_Count; Run++)
+    {
+        TEST_CHECK(Legacy_Run < Legacy_Count);
+        if(Legacy_Run < Legacy_Count)
+        {
+            TEST_CHECK_EQUAL(Legacy[Legacy_Run].Task, Test_Log[Run].Task);
+            TEST_CHECK_EQUAL(Legacy[Legacy_Run].Frame, Test_Log[Run].Frame);
+            Legacy_Run++;
+        }
+    }
+    TEST_CHECK_EQUAL(Legacy_Count, Legacy_Run);
+}
+
+/* Frames number, worst frame and utilization of the shipped table */
+static void Test_ScheduleInfo(void)
+{
+    Os_ScheduleInfoType Info;
+    Os_OverloadStatsType Overload;
+
+    Test_RunOs(6U);
+    Os_GetScheduleInfo(&Info);
+    TEST_CHECK_EQUAL(6U, Info.Frames_Number);
+    TEST_CHECK_EQUAL(3U, Info.Max_Tasks_Per_Frame);  /* Frame 0 (120 ms) releases all the tasks */
+    TEST_CHECK_EQUAL(150U, Info.Worst_Frame_Budget); /* 3 x 50 us */
+    TEST_CHECK_EQUAL(0U, Info.Worst_Frame_Load);     /* 150 us of 20 ms, under 1 % */
+    TEST_CHECK_EQUAL(4U, Info.Utilization);          /* (6 + 2 + 3) x 50 us in 120 ms */
+    TEST_CHECK_EQUAL(TRUE, Info.Rm_Schedulable);
+
+    /* Every frame ran at its tick */
+    Os_GetOverloadStats(&Overload);
+    TEST_CHECK_EQUAL(0U, Overload.Overruns);
+    TEST_CHECK_EQUAL(0U, Overload.Late_Frames);
+}
+
+int main(void)
+{
+    Sim_Init();
+
+    TEST_RUN(Test_ScheduleMatchesSwitch);
+    TEST_RUN(Test_ScheduleInfo);
+
+    return TEST_RESULT();
+}
@@ -0,0 +1,179 @@
+ /******************************************************************************
+ *
+ * Module: Test
+ *
+ * File Name: Test_OsOverload.c
+ *
+ * Description: Overload policy of the cooperative kernel run in virtual time: a task stalls
+ *              across several ticks and the late frames are dropped, caught up or degraded to
+ *              their critical tasks. Built once per OS_OVERLOAD_POLICY.
+ *
+ * Author: Tarek Emad
+ ******************************************************************************/
+
+/*
+ * Test_Stall_Task and Test_Critical_Task run in every frame, Test_Even_Task in the even ones,
+ * only Test_Critical_Task is kept by OS_OVERLOAD_DEGRADE
+ */
+#define OS_TASKS_LIST(OS_TASK) \
+    OS_TASK(Test_Stall_Task,    20, 0, 50, STD_OFF) \
+    OS_TASK(Test_Critical_Task, 20, 0, 50, STD_ON)  \
+    OS_TASK(Test_Even_Task,     40, 0, 50, STD_OFF)
+
+void Test_Stall_Task(void);
+void Test_Critical_Task(void);
+void Test_Even_Task(void);
+
+#include "Os_HostPort.c"
+#include "Test.h"
+
+/* Maximum number of task runs logged by a test */
+#define TEST_LOG_SIZE       (32U)
+
+/* Frame whose Test_Stall_Task run lasts TEST_STALL_TICKS SysTick periods */
+#define TEST_STALL_FRAME    (1U)
+#define TEST_STALL_TICKS    (4U)
+
+/* One task run: the task and the frame counter when it started */
+typedef struct
+{
+    Os_TaskIdType Task;
+    uint32 Frame;
+} Test_RunType;
+
+static Test_RunType Test_Log[TEST_LOG_SIZE];
+static uint32 Test_Log_Count = 0;
+
+/* Number of SysTick periods still to expire from the idle loop before the kernel is stopped */
+static uint32 Test_Ticks_Left = 0;
+
+/* TRUE once Test_Stall_Task stalled */
+static boolean Test_Stalled = FALSE;
+
+static void Test_LogRun(Os_TaskIdType Task)
+{
+    if(Test_Log_Count < TEST_LOG_SIZE)
+    {
+        Test_Log[Test_Log_Count].Task = Task;
+        Test_Log[Test_Log_Count].Frame = g_Frame_Counter;
+        Test_Log_Count++;
+    }
+}
+
+void Init_Task(void)
+{
+    Mcu_Init();
+}
+
+/* Its run of TEST_STALL_FRAME is still running at the next TEST_STALL_TICKS ticks */
+void Test_Stall_Task(void)
+{
+    uint32 Tick;
+
+    Test_LogRun(OS_TASK_ID_Test_Stall_Task);
+    if((Test_Stalled == FALSE) && (g_Frame_Counter == TEST_STALL_FRAME))
+    {
+        Test_Stalled = TRUE;
+        for(Tick = 0; Tick < TEST_STALL_TICKS; Tick++)
+        {
+            Os_HostPort_ExpireSysTick();
+        }
+    }
+}
+
+void Test_Critical_Task(void)
+{
+    Test_LogRun(OS_TASK_ID_Test_Critical_Task);
+}
+
+void Test_Even_Task(void)
+{
+    Test_LogRun(OS_TASK_ID_Test_Even_Task);
+}
+
+/* Each sleep of the idle loop lasts until the end of the SysTick period */
+static void Test_IdleHook(void)
+{
+    if(Test_Ticks_Left == 0U)
+    {
+        Os_HostPort_Stop();
+    }
+    Test_Ticks_Left--;
+    Os_HostPort_ExpireSysTick();
+}
+
+/* Run the kernel from Os_start for Ticks SysTick periods expired by the idle loop */
+static void Test_RunOs(uint32 Ticks)
+{
+    Sim_Reset();
+    Test_Log_Count = 0;
+    Test_Ticks_Left = Ticks;
+    Test_Stalled = FALSE;
+    Os_HostPort_SetIdleHook(Test_IdleHook);
+    Os_HostPort_Run(Os_start);
+}
+
+/*
+ * Test_Stall_Task of frame 1 runs until the tick of frame 5, frames 2 to 4 are late and frame 5
+ * is the latest one, then frames 6 and 7 come at their tick:
+ * - OS_OVERLOAD_SKIP drops frames 2 to 4 and runs frame 5.
+ * - OS_OVERLOAD_CATCH_UP drops frame 2 (3 frames behind) and runs frames 3, 4 and 5 back to back.
+ * - OS_OVERLOAD_DEGRADE only runs Test_Critical_Task in frames 2 to 5, frame 5 does not overrun
+ *   so frame 6 runs all its tasks again.
+ */
+static void Test_StalledTask(void)
+{
+    static const Test_RunType Expected[] = {
+        {OS_TASK_ID_Test_Stall_Task, 1U}, {OS_TASK_ID_Test_Critical_Task, 5U},
+#if (OS_OVERLOAD_POLICY == OS_OVERLOAD_CATCH_UP)
+        {OS_TASK_ID_Test_Stall_Task, 5U}, {OS_TASK_ID_Test_Critical_Task, 5U},
+        {OS_TASK_ID_Test_Stall_Task, 5U}, {OS_TASK_ID_Test_Critical_Task, 5U}, {OS_TASK_ID_Test_Even_Task, 5U},
+        {OS_TASK_ID_Test_Stall_Task, 5U}, {OS_TASK_ID_Test_Critical_Task, 5U},
+#elif (OS_OVERLOAD_POLICY == OS_OVERLOAD_DEGRADE)
+        {OS_TASK_ID_Test_Critical_Task, 5U}, {OS_TASK_ID_Test_Critical_Task, 5U},
+        {OS_TASK_ID_Test_Critical_Task, 5U}, {OS_TASK_ID_Test_Critical_Task, 5U},
+#else
+        {OS_TASK_ID_Test_Stall_Task, 5U}, {OS_TASK_ID_Test_Critical_Task, 5U},
+#endif
+        {OS_TASK_ID_Test_Stall_Task, 6U}, {OS_TASK_ID_Test_Critical_Task, 6U}, {OS_TASK_ID_Test_Even_Task, 6U},
+        {OS_TASK_ID_Test_Stall_Task, 7U}, {OS_TASK_ID_Test_Critical_Task, 7U}
+    };
+#if (OS_OVERLOAD_POLICY == OS_OVERLOAD_CATCH_UP)
+    static const uint32 Expected_Missed[OS_TASKS_NUMBER] = {1U, 1U, 1U};
+#elif (OS_OVERLOAD_POLICY == OS_OVERLOAD_DEGRADE)
+    static const uint32 Expected_Missed[OS_TASKS_NUMBER] = {4U, 0U, 2U};
+#else
+    static const uint32 Expected_Missed[OS_TASKS_NUMBER] = {3U, 3U, 2U};
+#endif
+    Os_OverloadStatsType Overload;
+    uint32 Run;
+    uint8 Task;
+
+    Test_RunOs(3U);
+    TEST_CHECK_EQUAL(7U, g_Frame_Counter);
+
+    TEST_CHECK_EQUAL(sizeof(Expected) / sizeof(Expected[0]), Test_Log_Count);
+    for(Run = 0; (Run < Test_Log_Count) && (Run < (sizeof(Expected) / sizeof(Expected[0]))); Run++)
+    {
+        TEST_CHECK_EQUAL(Expected[Run].Task, Test_Log[Run].Task);
+        TEST_CHECK_EQUAL(Expected[Run].Frame, Test_Log[Run].Frame);
+    }
+
+    /* Every policy sees the same overruns and late frames, only the dropped releases differ */
+    Os_GetOverloadStats(&Overload);
+    TEST_CHECK_EQUAL(TEST_STALL_TICKS, Overload.Overruns);
+    TEST_CHECK_EQUAL(3U, Overload.Late_Frames);
+    for(Task = 0; Task < OS_TASKS_NUMBER; Task++)
+    {
+        TEST_CHECK_EQUAL(Expected_Missed[Task], Overload.Missed_Activations[Task]);
+    }
+}
+
+int main(void)
+{
+    Sim_Init();
+
+    TEST_RUN(Test_StalledTask);
+
+    return TEST_RESULT();
+}
@@ -0,0 +1,288 @@
+ /******************************************************************************
+ *
+ * Module: Test
+ *
+ * File Name: Test_OsPreemptive.c
+ *
+ * Description: Unit tests of the preemptive kernel run in virtual time on the host port:
+ *              rate monotonic priorities, initial task frames, preemption order and the
+ *              context of a preempted task across PendSV.
+ *
+ * Author: Tarek Emad
+ ******************************************************************************/
+
+#include "Os_HostPort.c"
+#include "Test.h"
+
+/* Maximum number of task runs logged by a test */
+#define TEST_LOG_SIZE       (64U)
+
+/* Frame whose tick releases App_Task and Button_Task (60 ms) */
+#define TEST_APP_FRAME      (3U)
+
+/* Value kept by App_Task in a local variable across its preemption */
+#define TEST_APP_LOCAL      (0x5A5AA5A5U)
+
+/* Log entry of App_Task when it resumes after its preemption */
+#define TEST_APP_RESUMED    (OS_TASKS_NUMBER)
+
+/* One task run: the task and the number of the frame it ran in */
+typedef struct
+{
+    Os_TaskIdType Task;
+    uint32 Frame;
+} Test_RunType;
+
+static Test_RunType Test_Log[TEST_LOG_SIZE];
+static uint32 Test_Log_Count = 0;
+
+/* Number of SysTick periods still to expire before the kernel is stopped */
+static uint32 Test_Ticks_Left = 0;
+
+/* TRUE to make the first App_Task run take longer than one SysTick period */
+static boolean Test_App_Overruns = FALSE;
+
+/* TRUE to release App_Task from an interrupt at the end of frame 2 instead of the tick of frame 3 */
+static boolean Test_App_Event = FALSE;
+
+/* Local of App_Task and running task seen after the preemption */
+static uint32 Test_App_Local_After = 0;
+static Os_TcbType *Test_App_Tcb_After = NULL_PTR;
+
+static void Test_LogRun(Os_TaskIdType Task, uint32 Frame)
+{
+    if(Test_Log_Count < TEST_LOG_SIZE)
+    {
+        Test_Log[Test_Log_Count].Task = Task;
+        Test_Log[Test_Log_Count].Frame = Frame;
+        Test_Log_Count++;
+    }
+}
+
+void Init_Task(void)
+{
+    Mcu_Init();
+}
+
+void Button_Task(void)
+{
+    Test_LogRun(OS_TASK_ID_Button_Task, g_Frame_Counter);
+}
+
+/* The first run of App_Task is still running at the next tick, which releases higher priority tasks */
+void App_Task(void)
+{
+    volatile uint32 Local = TEST_APP_LOCAL;
+
+    Test_LogRun(OS_TASK_ID_App_Task, g_Frame_Counter);
+    if(Test_App_Overruns == TRUE)
+    {
+        Test_App_Overruns = FALSE;
+        Test_Ticks_Left--;
+        Os_HostPort_ExpireSysTick();
+
+        Test_LogRun(TEST_APP_RESUMED, g_Frame_Counter);
+        Test_App_Local_After = Local;
+        Test_App_Tcb_After = g_Os_Current_Tcb;
+    }
+}
+
+void Led_Task(void)
+{
+    Test_LogRun(OS_TASK_ID_Led_Task, g_Frame_Counter);
+}
+
+/* Interrupt notification releasing App_Task */
+static void Test_AppEventIsr(void)
+{
+    Os_ActivateTask(OS_TASK_ID_App_Task);
+}
+
+/* Each sleep of the idle loop lasts until the end of the SysTick period, or until the App_Task event */
+static void Test_IdleHook(void)
+{
+    if((Test_App_Event == TRUE) && (g_Frame_Counter == (TEST_APP_FRAME - 1U)))
+    {
+        Test_App_Event = FALSE;
+        Os_HostPort_RaiseInterrupt(Test_AppEventIsr);
+        return;
+    }
+    if(Test_Ticks_Left == 0U)
+    {
+        Os_HostPort_Stop();
+    }
+    Test_Ticks_Left--;
+    Os_HostPort_ExpireSysTick();
+}
+
+/* Run the kernel from Os_start for Ticks SysTick periods */
+static void Test_RunOs(uint32 Ticks)
+{
+    Sim_Reset();
+    Test_Log_Count = 0;
+    Test_Ticks_Left = Ticks;
+    Os_HostPort_SetIdleHook(Test_IdleHook);
+    Os_HostPort_Run(Os_start);
+}
+
+/* The shorter the period the higher the priority */
+static void Test_RmPriorities(void)
+{
+    Test_RunOs(0U);
+
+    TEST_CHECK_EQUAL(0U, g_Os_Task_Priority[OS_TASK_ID_Button_Task]);
+    TEST_CHECK_EQUAL(1U, g_Os_Task_Priority[OS_TASK_ID_Led_Task]);
+    TEST_CHECK_EQUAL(2U, g_Os_Task_Priority[OS_TASK_ID_App_Task]);
+    TEST_CHECK_EQUAL(OS_TASK_ID_Button_Task, g_Os_Tcbs[0].Task);
+    TEST_CHECK_EQUAL(OS_TASK_ID_App_Task, g_Os_Tcbs[2].Task);
+
+    /* Frame 0 (120 ms) releases all the tasks, frame 3 (60 ms) Button_Task and App_Task */
+    TEST_CHECK_EQUAL(0x7U, g_Os_Frame_Priorities[0]);
+    TEST_CHECK_EQUAL(0x1U, g_Os_Frame_Priorities[1]);
+    TEST_CHECK_EQUAL(0x3U, g_Os_Frame_Priorities[2]);
+    TEST_CHECK_EQUAL(0x5U, g_Os_Frame_Priorities[TEST_APP_FRAME]);
+
+    /* PendSV at the lowest priority */
+    TEST_CHECK_EQUAL(OS_PENDSV_INTERRUPT_PRIORITY, (NVIC_SYSTEM_PRI3_REG >> OS_PENDSV_PRIORITY_BITS_POS) & 0x7U);
+}
+
+/* Frame restored by the first switch to each task: PendSV part then the hardware part */
+static void Test_InitialFrames(void)
+{
+    uint32 Priority;
+    uint32 *Sp;
+
+    Test_RunOs(0U);
+
+    for(Priority = 0; Priority < OS_TASKS_NUMBER; Priority++)
+    {
+        Sp = g_Os_Tcbs[Priority].Sp;
+        TEST_CHECK(Sp == ((uint32 *)&g_Os_Stacks[Priority][OS_STACK_UNITS] - 17));
+        TEST_CHECK_EQUAL(OS_EXC_RETURN_THREAD_PSP, Sp[8]);
+        TEST_CHECK_EQUAL(Priority, Sp[9]);                                    /* R0 */
+        TEST_CHECK_EQUAL((uint32)Os_TaskEntry & 0xFFFFFFFEU, Sp[15]);         /* PC */
+        TEST_CHECK_EQUAL(0U, Sp[15] & 1U);
+        TEST_CHECK_EQUAL(OS_INITIAL_XPSR, Sp[16]);                            /* xPSR */
+    }
+    TEST_CHECK(g_Os_Current_Tcb == &g_Os_Tcbs[OS_IDLE_PRIORITY]);
+}
+
+/*
+ * Each tick runs its tasks in priority order, not in the order of the table: Button_Task,
+ * Led_Task then App_Task, and the idle loop gets the CPU back in between
+ */
+static void Test_PreemptionOrder(void)
+{
+    static const Test_RunType Expected_Runs[] = {
+        {OS_TASK_ID_Button_Task, 1U},
+        {OS_TASK_ID_Button_Task, 2U}, {OS_TASK_ID_Led_Task, 2U},
+        {OS_TASK_ID_Button_Task, 3U}, {OS_TASK_ID_App_Task, 3U},
+        {OS_TASK_ID_Button_Task, 4U}, {OS_TASK_ID_Led_Task, 4U},
+        {OS_TASK_ID_Button_Task, 5U},
+        {OS_TASK_ID_Button_Task, 6U}, {OS_TASK_ID_Led_Task, 6U},
+        {OS_TASK_ID_App_Task, 6U}
+    };
+    Os_OverloadStatsType Overload;
+    uint32 Index;
+
+    Test_RunOs(6U);
+
+    TEST_CHECK_EQUAL(6U, g_Frame_Counter);
+    TEST_CHECK_EQUAL(sizeof(Expected_Runs) / sizeof(Expected_Runs[0]), Test_Log_Count);
+    for(Index = 0; (Index < Test_Log_Count) && (Index < (sizeof(Expected_Runs) / sizeof(Expected_Runs[0]))); Index++)
+    {
+        TEST_CHECK_EQUAL(Expected_Runs[Index].Task, Test_Log[Index].Task);
+        TEST_CHECK_EQUAL(Expected_Runs[Index].Frame, Test_Log[Index].Frame);
+    }
+    TEST_CHECK_EQUAL(0U, g_Os_Ready_Mask);
+    TEST_CHECK(g_Os_Current_Tcb == &g_Os_Tcbs[OS_IDLE_PRIORITY]);
+
+    Os_GetOverloadStats(&Overload);
+    TEST_CHECK_EQUAL(0U, Overload.Overruns);
+}
+
+/*
+ * App_Task is preempted by the tick of frame 4: the tasks it releases run to completion at once,
+ * then PendSV switches back to App_Task which resumes with its local and its control block
+ */
+static void Test_PreemptedTaskResumes(void)
+{
+    static const Test_RunType Expected_Runs[] = {
+        {OS_TASK_ID_Button_Task, 3U}, {OS_TASK_ID_App_Task, 3U},
+        {OS_TASK_ID_Button_Task, 4U}, {OS_TASK_ID_Led_Task, 4U},
+        {TEST_APP_RESUMED, 4U},
+        {OS_TASK_ID_Button_Task, 5U}
+    };
+    uint32 Index;
+    uint32 Offset;
+
+    Test_App_Overruns = TRUE;
+    Test_App_Local_After = 0;
+    Test_App_Tcb_After = NULL_PTR;
+    Test_RunOs(5U);
+
+    TEST_CHECK_EQUAL(5U, g_Frame_Counter);
+    TEST_CHECK_EQUAL(TEST_APP_LOCAL, Test_App_Local_After);
+    TEST_CHECK(Test_App_Tcb_After == &g_Os_Tcbs[g_Os_Task_Priority[OS_TASK_ID_App_Task]]);
+
+    /* Frames 1 and 2 ran as in Test_PreemptionOrder */
+    Offset = 3U;
+    TEST_CHECK_EQUAL(Offset + (sizeof(Expected_Runs) / sizeof(Expected_Runs[0])), Test_Log_Count);
+    for(Index = 0; (Index + Offset < Test_Log_Count) && (Index < (sizeof(Expected_Runs) / sizeof(Expected_Runs[0]))); Index++)
+    {
+        TEST_CHECK_EQUAL(Expected_Runs[Index].Task, Test_Log[Index + Offset].Task);
+        TEST_CHECK_EQUAL(Expected_Runs[Index].Frame, Test_Log[Index + Offset].Frame);
+    }
+    TEST_CHECK(g_Os_Current_Tcb == &g_Os_Tcbs[OS_IDLE_PRIORITY]);
+}
+
+/*
+ * App_Task released by an event is still running at the tick of frame 3 which also releases it:
+ * the frame release is merged with the running one and is neither an overrun nor a missed activation
+ */
+static void Test_EventReleaseNotOverrun(void)
+{
+    static const Test_RunType Expected_Runs[] = {
+        {OS_TASK_ID_App_Task, 2U},
+        {OS_TASK_ID_Button_Task, 3U},
+        {TEST_APP_RESUMED, 3U},
+        {OS_TASK_ID_Button_Task, 4U}, {OS_TASK_ID_Led_Task, 4U}
+    };
+    Os_OverloadStatsType Overload;
+    uint32 Index;
+    uint32 Offset;
+
+    Test_App_Event = TRUE;
+    Test_App_Overruns = TRUE;
+    Test_RunOs(4U);
+
+    TEST_CHECK_EQUAL(4U, g_Frame_Counter);
+    TEST_CHECK_EQUAL(TEST_APP_LOCAL, Test_App_Local_After);
+
+    /* Frames 1 and 2 ran as in Test_PreemptionOrder */
+    Offset = 3U;
+    TEST_CHECK_EQUAL(Offset + (sizeof(Expected_Runs) / sizeof(Expected_Runs[0])), Test_Log_Count);
+    for(Index = 0; (Index + Offset < Test_Log_Count) && (Index < (sizeof(Expected_Runs) / sizeof(Expected_Runs[0]))); Index++)
+    {
+        TEST_CHECK_EQUAL(Expected_Runs[Index].Task, Test_Log[Index + Offset].Task);
+        TEST_CHECK_EQUAL(Expected_Runs[Index].Frame, Test_Log[Index + Offset].Frame);
+    }
+
+    Os_GetOverloadStats(&Overload);
+    TEST_CHECK_EQUAL(0U, Overload.Overruns);
+    TEST_CHECK_EQUAL(0U, Overload.Missed_Activations[OS_TASK_ID_App_Task]);
+    TEST_CHECK_EQUAL(0U, g_Os_Event_Ready_Mask);
+}
+
+int main(void)
+{
+    Sim_Init();
+
+    TEST_RUN(Test_RmPriorities);
+    TEST_RUN(Test_InitialFrames);
+    TEST_RUN(Test_PreemptionOrder);
+    TEST_RUN(Test_PreemptedTaskResumes);
+    TEST_RUN(Test_EventReleaseNotOverrun);
+
+    return TEST_RESULT();
+}
@@ -0,0 +1,196 @@
+ /******************************************************************************
+ *
+ * Module: Test
+ *
+ * File Name: Test_OsTickless.c
+ *
+ * Description: Unit tests of the tickless mode run in virtual time: frame skipping,
+ *              dispatched frames and idle accounting of a task table with empty frames.
+ *
+ * Author: Tarek Emad
+ ******************************************************************************/
+
+/*
+ * Frames with tasks: 0 (Test_Fast_Task), 2 (Test_Slow_Task) and 3 (Test_Fast_Task),
+ * so SysTick periods of 2, 1 and 3 frames instead of 6 ticks per major frame
+ */
+#define OS_TASKS_LIST(OS_TASK) \
+    OS_TASK(Test_Fast_Task,  60,  0, 50, STD_ON)  \
+    OS_TASK(Test_Slow_Task, 120, 40, 50, STD_OFF)
+
+void Test_Fast_Task(void);
+void Test_Slow_Task(void);
+
+#include "Os_HostPort.c"
+#include "Test.h"
+
+/* Core clock cycles of one minor frame at 80 MHz */
+#define TEST_FRAME_CYCLES   (80000U * OS_BASE_TIME)
+
+/* Core clock cycles taken by each task run */
+#define TEST_TASK_CYCLES    (8000U)
+
+/* SysTick current value register */
+#define TEST_SYSTICK_CURRENT (0xE000E018U)
+
+/* Maximum number of task runs and SysTick periods logged by a test */
+#define TEST_LOG_SIZE       (32U)
+
+/* One task run: the task and the number of the frame it ran in */
+typedef struct
+{
+    Os_TaskIdType Task;
+    uint32 Frame;
+} Test_RunType;
+
+static Test_RunType Test_Log[TEST_LOG_SIZE];
+static uint32 Test_Log_Count = 0;
+
+/* Period loaded by SysTick at each expiry in core clock cycles */
+static uint32 Test_Periods[TEST_LOG_SIZE];
+static uint32 Test_Periods_Count = 0;
+
+/* Number of SysTick periods still to expire before the kernel is stopped */
+static uint32 Test_Ticks_Left = 0;
+
+/* A task run is logged and takes TEST_TASK_CYCLES of the running SysTick period */
+static void Test_LogRun(Os_TaskIdType Task)
+{
+    if(Test_Log_Count < TEST_LOG_SIZE)
+    {
+        Test_Log[Test_Log_Count].Task = Task;
+        Test_Log[Test_Log_Count].Frame = g_Frame_Counter;
+        Test_Log_Count++;
+    }
+    Sim_Poke(TEST_SYSTICK_CURRENT, Sim_Peek(TEST_SYSTICK_CURRENT) - TEST_TASK_CYCLES);
+}
+
+void Init_Task(void)
+{
+    Mcu_Init();
+}
+
+void Test_Fast_Task(void)
+{
+    Test_LogRun(OS_TASK_ID_Test_Fast_Task);
+}
+
+void Test_Slow_Task(void)
+{
+    Test_LogRun(OS_TASK_ID_Test_Slow_Task);
+}
+
+/* Each sleep of the idle loop lasts until the end of the SysTick period */
+static void Test_IdleHook(void)
+{
+    if(Test_Ticks_Left == 0U)
+    {
+        Os_HostPort_Stop();
+    }
+    Test_Ticks_Left--;
+    Os_HostPort_ExpireSysTick();
+    if(Test_Periods_Count < TEST_LOG_SIZE)
+    {
+        Test_Periods[Test_Periods_Count] = Sim_Peek(TEST_SYSTICK_CURRENT) + 1U;
+        Test_Periods_Count++;
+    }
+}
+
+/* The frames to skip from each frame to the next one with tasks */
+static void Test_FrameSkip(void)
+{
+    Os_BuildSchedule();
+    TEST_CHECK_EQUAL(0x1U, g_Os_Frame_Tasks[0]);
+    TEST_CHECK_EQUAL(0x0U, g_Os_Frame_Tasks[1]);
+    TEST_CHECK_EQUAL(0x2U, g_Os_Frame_Tasks[2]);
+    TEST_CHECK_EQUAL(0x1U, g_Os_Frame_Tasks[3]);
+    TEST_CHECK_EQUAL(0x0U, g_Os_Frame_Tasks[4]);
+    TEST_CHECK_EQUAL(0x0U, g_Os_Frame_Tasks[5]);
+
+    TEST_CHECK_EQUAL(2U, g_Os_Frame_Skip[0]);
+    TEST_CHECK_EQUAL(1U, g_Os_Frame_Skip[1]);
+    TEST_CHECK_EQUAL(1U, g_Os_Frame_Skip[2]);
+    TEST_CHECK_EQUAL(3U, g_Os_Frame_Skip[3]);
+    TEST_CHECK_EQUAL(2U, g_Os_Frame_Skip[4]);
+    TEST_CHECK_EQUAL(1U, g_Os_Frame_Skip[5]);
+}
+
+/*
+ * Three major frames take 9 ticks instead of 18: each tick moves g_Frame_Counter to the next frame
+ * with tasks, every reached frame is dispatched once and the empty frames are never late
+ */
+static void Test_TickSkipping(void)
+{
+    static const Test_RunType Expected_Runs[] = {
+        {OS_TASK_ID_Test_Slow_Task,  2U}, {OS_TASK_ID_Test_Fast_Task,  3U}, {OS_TASK_ID_Test_Fast_Task,  6U},
+        {OS_TASK_ID_Test_Slow_Task,  8U}, {OS_TASK_ID_Test_Fast_Task,  9U}, {OS_TASK_ID_Test_Fast_Task, 12U},
+        {OS_TASK_ID_Test_Slow_Task, 14U}, {OS_TASK_ID_Test_Fast_Task, 15U}, {OS_TASK_ID_Test_Fast_Task, 18U}
+    };
+    /* The first period (2 frames) is set by SysTick_Start, then each expiry loads the one programmed at the previous tick */
+    static const uint32 Expected_Frames[] = {1U, 3U, 2U, 1U, 3U, 2U, 1U, 3U, 2U};
+    Os_OverloadStatsType Overload;
+    uint32 Index;
+
+    Sim_Reset();
+    Test_Log_Count = 0;
+    Test_Periods_Count = 0;
+    Test_Ticks_Left = 9U;
+    Os_HostPort_SetIdleHook(Test_IdleHook);
+    Os_HostPort_Run(Os_start);
+
+    TEST_CHECK_EQUAL(18U, g_Frame_Counter);
+    TEST_CHECK_EQUAL(18U, g_Dispatched_Frame_Counter);
+    TEST_CHECK_EQUAL(0U, g_Frame_Index);
+
+    TEST_CHECK_EQUAL(sizeof(Expected_Runs) / sizeof(Expected_Runs[0]), Test_Log_Count);
+    for(Index = 0; (Index < Test_Log_Count) && (Index < (sizeof(Expected_Runs) / sizeof(Expected_Runs[0]))); Index++)
+    {
+        TEST_CHECK_EQUAL(Expected_Runs[Index].Task, Test_Log[Index].Task);
+        TEST_CHECK_EQUAL(Expected_Runs[Index].Frame, Test_Log[Index].Frame);
+    }
+
+    TEST_CHECK_EQUAL(9U, Test_Periods_Count);
+    for(Index = 0; Index < Test_Periods_Count; Index++)
+    {
+        TEST_CHECK_EQUAL(Expected_Frames[Index] * TEST_FRAME_CYCLES, Test_Periods[Index]);
+    }
+
+    Os_GetOverloadStats(&Overload);
+    TEST_CHECK_EQUAL(0U, Overload.Overruns);
+    TEST_CHECK_EQUAL(0U, Overload.Late_Frames);
+}
+
+/*
+ * Each tick wakes the CPU up once, the elapsed time covers the skipped frames and the idle
+ * time is the elapsed time less the task runs (one cycle per period is the reload to 0 step)
+ */
+static void Test_IdleAccounting(void)
+{
+    Os_IdleStatsType Idle;
+
+    Sim_Reset();
+    Test_Log_Count = 0;
+    Test_Periods_Count = 0;
+    Test_Ticks_Left = 9U;
+    Os_HostPort_SetIdleHook(Test_IdleHook);
+    Os_HostPort_Run(Os_start);
+
+    Os_GetIdleStats(&Idle);
+    TEST_CHECK_EQUAL(9U, Idle.Ticks);
+    TEST_CHECK_EQUAL(9U, Idle.Wakeups);
+    TEST_CHECK_EQUAL(3U * OS_FRAMES_NUMBER * (uint64)TEST_FRAME_CYCLES, Idle.Elapsed_Cycles);
+
+    /* The tasks of the 9th tick run in the 10th period, which is not over */
+    TEST_CHECK_EQUAL(Idle.Elapsed_Cycles - 9U - (8U * TEST_TASK_CYCLES), Idle.Idle_Cycles);
+}
+
+int main(void)
+{
+    Sim_Init();
+
+    TEST_RUN(Test_FrameSkip);
+    TEST_RUN(Test_TickSkipping);
+    TEST_RUN(Test_IdleAccounting);
+
+    return TEST_RESULT();
+}
@@ -0,0 +1,218 @@
+ /******************************************************************************
+ *
+ * Module: Test
+ *
+ * File Name: Test_Port.c
+ *
+ * Description: Unit tests of Port_Init against the register simulator and the
+ *              register accesses of the per-pin Port_Init it replaced.
+ *
+ * Author: Tarek Emad
+ ******************************************************************************/
+
+#include "Test.h"
+#include "Sim.h"
+#include "Port.h"
+#include "tm4c123gh6pm_registers.h"
+
+/* GPIOLOCK/GPIOCR/GPIODEN of PORTF in its AHB aperture */
+#define TEST_PORTF_AHB_LOCK_ADDRESS   (0x4005D520U)
+#define TEST_PORTF_AHB_CR_ADDRESS     (0x4005D524U)
+#define TEST_PORTF_AHB_DEN_ADDRESS    (0x4005D51CU)
+
+/* APB base address of each port, the only aperture known by the per-pin Port_Init */
+static const uint32 Test_ApbBaseAddress[PORT_NUMBER_OF_PORTS] = {
+    GPIO_PORTA_BASE_ADDRESS, GPIO_PORTB_BASE_ADDRESS, GPIO_PORTC_BASE_ADDRESS,
+    GPIO_PORTD_BASE_ADDRESS, GPIO_PORTE_BASE_ADDRESS, GPIO_PORTF_BASE_ADDRESS
+};
+
+/* Register of a port at an offset from its base address */
+#define TEST_PORT_REG(BASE, OFFSET)   (*HW_REGISTER_ADDRESS((BASE) + (OFFSET)))
+
+/*
+ * Reference copy of the per-pin Port_Init replaced by the per-port register images:
+ * each pin enables the clock of its port, waits for PRGPIO and read-modify-writes
+ * every register for its own bit. The JTAG pins are skipped.
+ */
+static void Test_PerPinPortInit(const Port_ConfigType *ConfigPtr)
+{
+    uint8 Channel;
+
+    for (Channel = 0; Channel < PORT_CONFIGURED_PINS; Channel++)
+    {
+        Port_ConfigChannel Pin_Config = ConfigPtr->Channels[Channel];
+        uint8 Port = PORT_CHANNEL_PORT_NUM(Pin_Config);
+        uint8 Pin = PORT_CHANNEL_PIN_NUM(Pin_Config);
+        Port_PinInitialMode Mode = PORT_CHANNEL_INITIAL_MODE(Pin_Config);
+        uint32 Base = Test_ApbBaseAddress[Port];
+
+        SYSCTL_RCGCGPIO_REG |= ((uint32)1 << Port);
+        while ((SYSCTL_PRGPIO_REG & ((uint32)1 << Port)) == 0);
+
+        if (PORT_IS_JTAG_PIN(Port, Pin))
+        {
+            continue;
+        }
+        else if (PORT_IS_LOCKED_PIN(Port, Pin))
+        {
+            TEST_PORT_REG(Base, PORT_LOCK_REG_OFFSET) = PORT_UNLOCK_KEY;
+            TEST_PORT_REG(Base, PORT_COMMIT_REG_OFFSET) |= ((uint32)1 << Pin);
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+
+        if (Mode == PORT_PIN_MODE_DIO)
+        {
+            TEST_PORT_REG(Base, PORT_ALT_FUNC_REG_OFFSET) &= ~((uint32)1 << Pin);
+            TEST_PORT_REG(Base, PORT_ANALOG_MODE_SEL_REG_OFFSET) &= ~((uint32)1 << Pin);
+            TEST_PORT_REG(Base, PORT_CTL_REG_OFFSET) &= ~((uint32)0x0000000F << (Pin * 4));
+            TEST_PORT_REG(Base, PORT_DIGITAL_ENABLE_REG_OFFSET) |= ((uint32)1 << Pin);
+        }
+        else
+        {
+            /* Only DIO pins are configured by the shipped configuration */
+        }
+
+        if (PORT_CHANNEL_DIRECTION(Pin_Config) == OUTPUT)
+        {
+            TEST_PORT_REG(Base, PORT_DIR_REG_OFFSET) |= ((uint32)1 << Pin);
+        }
+        else
+        {
+            TEST_PORT_REG(Base, PORT_DIR_REG_OFFSET) &= ~((uint32)1 << Pin);
+        }
+
+        if (PORT_CHANNEL_RESISTOR(Pin_Config) == PULL_UP)
+        {
+            TEST_PORT_REG(Base, PORT_PULL_UP_REG_OFFSET) |= ((uint32)1 << Pin);
+        }
+        else if (PORT_CHANNEL_RESISTOR(Pin_Config) == PULL_DOWN)
+        {
+            TEST_PORT_REG(Base, PORT_PULL_DOWN_REG_OFFSET) |= ((uint32)1 << Pin);
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+
+        if (PORT_CHANNEL_INITIAL_VALUE(Pin_Config) == STD_HIGH)
+        {
+            TEST_PORT_REG(Base, PORT_DATA_REG_OFFSET) |= ((uint32)1 << Pin);
+        }
+        else
+        {
+            TEST_PORT_REG(Base, PORT_DATA_REG_OFFSET) &= ~((uint32)1 << Pin);
+        }
+    }
+}
+
+/* Copy of the shipped configuration with PF0 (a locked pin) added as a pulled-up input */
+static void Test_GetLockedPinConfig(Port_ConfigType *ConfigPtr)
+{
+    Port_RegisterImageType *Image_Ptr = &ConfigPtr->Images[5];
+
+    *ConfigPtr = Port_Configuration;
+    Image_Ptr->pins_mask |= 0x01U;
+    Image_Ptr->commit_mask |= 0x01U;
+    Image_Ptr->den |= 0x01U;
+    Image_Ptr->pur |= 0x01U;
+    Image_Ptr->pctl_mask |= 0x0000000FU;
+}
+
+/* Sum of the read and write counters of the Port_Init statistics */
+static void Test_GetStatsTotals(const Port_InitStatsType *Stats, uint32 *Reads, uint32 *Writes)
+{
+    uint8 Reg;
+
+    *Reads = 0;
+    *Writes = 0;
+    for (Reg = 0; Reg < PORT_STATS_REGS_NUMBER; Reg++)
+    {
+        *Reads += Stats->ReadCount[Reg];
+        *Writes += Stats->WriteCount[Reg];
+    }
+}
+
+/* The statistics of Port_Init count every register access the simulator sees, GPIOHBCTL included */
+static void Test_InitStatsMatchBus(void)
+{
+    Sim_CountersType Counters;
+    Port_InitStatsType Stats;
+    uint32 Reads;
+    uint32 Writes;
+
+    Sim_Reset();
+    Sim_SetPrgpioDelay(4U);
+    Port_Init(&Port_Configuration);
+    Sim_GetCounters(&Counters);
+    Port_GetInitStats(&Stats);
+    Test_GetStatsTotals(&Stats, &Reads, &Writes);
+
+    TEST_CHECK_EQUAL(Counters.Reads, Reads);
+    TEST_CHECK_EQUAL(Counters.Writes, Writes);
+    TEST_CHECK_EQUAL(1U, Stats.ReadCount[PORT_STATS_GPIOHBCTL]);
+    TEST_CHECK_EQUAL(1U, Stats.WriteCount[PORT_STATS_GPIOHBCTL]);
+    TEST_CHECK_EQUAL(5U, Stats.ReadCount[PORT_STATS_PRGPIO]);
+}
+
+/* Port_Init locks GPIOCR again once the locked pins are committed and written */
+static void Test_InitRelocks(void)
+{
+    Sim_CountersType Counters;
+    Port_InitStatsType Stats;
+    Port_ConfigType Config;
+
+    Test_GetLockedPinConfig(&Config);
+    Sim_Reset();
+    Port_Init(&Config);
+    Sim_GetCounters(&Counters);
+    Port_GetInitStats(&Stats);
+
+    TEST_CHECK_EQUAL(1U, Sim_Peek(TEST_PORTF_AHB_LOCK_ADDRESS));
+    TEST_CHECK_EQUAL(0x01U, Sim_Peek(TEST_PORTF_AHB_CR_ADDRESS) & 0x01U);
+    TEST_CHECK_EQUAL(0x1FU, Sim_Peek(TEST_PORTF_AHB_DEN_ADDRESS) & 0x1FU);
+    TEST_CHECK_EQUAL(0U, Counters.Commit_Violations);
+    TEST_CHECK_EQUAL(0U, Counters.Lock_Violations);
+    TEST_CHECK_EQUAL(2U, Stats.WriteCount[PORT_STATS_LOCK]);
+
+    /* Without a locked pin GPIOLOCK is never written */
+    Sim_Reset();
+    Port_Init(&Port_Configuration);
+    Port_GetInitStats(&Stats);
+    TEST_CHECK_EQUAL(0U, Stats.WriteCount[PORT_STATS_LOCK]);
+}
+
+/* Register accesses of the per-pin Port_Init against the per-port one for the shipped configuration */
+static void Test_InitWritesBeforeAfter(void)
+{
+    Sim_CountersType Before;
+    Sim_CountersType After;
+
+    Sim_Reset();
+    Test_PerPinPortInit(&Port_Configuration);
+    Sim_GetCounters(&Before);
+
+    Sim_Reset();
+    Port_Init(&Port_Configuration);
+    Sim_GetCounters(&After);
+
+    printf("  Port_Init per pin: %3lu writes %3lu reads %4lu bus cycles | per port: %3lu writes %3lu reads %4lu bus cycles\n",
+           (unsigned long)Before.Writes, (unsigned long)Before.Reads, (unsigned long)Before.Bus_Cycles,
+           (unsigned long)After.Writes, (unsigned long)After.Reads, (unsigned long)After.Bus_Cycles);
+
+    TEST_CHECK(After.Writes < Before.Writes);
+    TEST_CHECK(After.Bus_Cycles < Before.Bus_Cycles);
+}
+
+int main(void)
+{
+    Sim_Init();
+
+    TEST_RUN(Test_InitStatsMatchBus);
+    TEST_RUN(Test_InitRelocks);
+    TEST_RUN(Test_InitWritesBeforeAfter);
+
+    return TEST_RESULT();
+}
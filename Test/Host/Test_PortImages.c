@@ -0,0 +1,100 @@
+ /******************************************************************************
+ *
+ * Module: Test
+ *
+ * File Name: Test_PortImages.c
+ *
+ * Description: The register images precomputed in Port_PBcfg.c must be the ones the
+ *              interpreted Port_Init computes from the same pins, field by field and
+ *              in the registers it writes on the simulator.
+ *
+ * Author: Tarek Emad
+ ******************************************************************************/
+
+#include "Test.h"
+#include "Sim.h"
+#include "Test_PortImages.h"
+
+/* GPIO register of a port in the aperture Port_Init uses for it */
+static uint32 Test_PeekPortReg(uint8 Port, uint32 Offset)
+{
+    static const uint32 Apb_Base[PORT_NUMBER_OF_PORTS] = {
+        0x40004000U, 0x40005000U, 0x40006000U, 0x40007000U, 0x40024000U, 0x40025000U
+    };
+    uint32 Base = ((PORT_AHB_PORTS_MASK & (1U << Port)) != 0U) ? (0x40058000U + ((uint32)Port << 12)) : Apb_Base[Port];
+
+    return Sim_Peek(Base + Offset);
+}
+
+/* Every field of every port image is the same */
+static void Test_ImagesEqual(void)
+{
+    Port_RegisterImageType Interpreted[PORT_NUMBER_OF_PORTS];
+    const Port_RegisterImageType *Precomputed = Port_Configuration.Images;
+    uint8 Port;
+
+    Test_BuildInterpretedImages(Port_Configuration.Channels, Interpreted);
+    for (Port = 0; Port < PORT_NUMBER_OF_PORTS; Port++)
+    {
+        printf("  port %u: pins 0x%02lX commit 0x%02lX dir 0x%02lX den 0x%02lX afsel 0x%02lX amsel 0x%02lX pctl 0x%08lX\n",
+               Port, (unsigned long)Precomputed[Port].pins_mask, (unsigned long)Precomputed[Port].commit_mask,
+               (unsigned long)Precomputed[Port].dir, (unsigned long)Precomputed[Port].den,
+               (unsigned long)Precomputed[Port].afsel, (unsigned long)Precomputed[Port].amsel,
+               (unsigned long)Precomputed[Port].pctl);
+        TEST_CHECK_EQUAL(Interpreted[Port].pins_mask, Precomputed[Port].pins_mask);
+        TEST_CHECK_EQUAL(Interpreted[Port].commit_mask, Precomputed[Port].commit_mask);
+        TEST_CHECK_EQUAL(Interpreted[Port].dir, Precomputed[Port].dir);
+        TEST_CHECK_EQUAL(Interpreted[Port].den, Precomputed[Port].den);
+        TEST_CHECK_EQUAL(Interpreted[Port].afsel, Precomputed[Port].afsel);
+        TEST_CHECK_EQUAL(Interpreted[Port].amsel, Precomputed[Port].amsel);
+        TEST_CHECK_EQUAL(Interpreted[Port].pur, Precomputed[Port].pur);
+        TEST_CHECK_EQUAL(Interpreted[Port].pdr, Precomputed[Port].pdr);
+        TEST_CHECK_EQUAL(Interpreted[Port].data, Precomputed[Port].data);
+        TEST_CHECK_EQUAL(Interpreted[Port].pctl_mask, Precomputed[Port].pctl_mask);
+        TEST_CHECK_EQUAL(Interpreted[Port].pctl, Precomputed[Port].pctl);
+        TEST_CHECK_EQUAL(Interpreted[Port].refresh_mask, Precomputed[Port].refresh_mask);
+    }
+}
+
+/* The registers written by the interpreted Port_Init hold the precomputed values on the configured pins */
+static void Test_RegistersMatchImages(void)
+{
+    const Port_RegisterImageType *Image_Ptr;
+    Sim_CountersType Counters;
+    uint8 Port;
+
+    Sim_Reset();
+    Test_InterpretedPortInit(Port_Configuration.Channels);
+    Sim_GetCounters(&Counters);
+    TEST_CHECK_EQUAL(0U, Counters.Commit_Violations);
+    TEST_CHECK_EQUAL(0U, Counters.Clock_Violations);
+    TEST_CHECK_EQUAL(0U, Counters.Aperture_Violations);
+
+    for (Port = 0; Port < PORT_NUMBER_OF_PORTS; Port++)
+    {
+        Image_Ptr = &Port_Configuration.Images[Port];
+        if (Image_Ptr->pins_mask == 0U)
+        {
+            continue;
+        }
+        TEST_CHECK_EQUAL(Image_Ptr->dir, Test_PeekPortReg(Port, PORT_DIR_REG_OFFSET) & Image_Ptr->pins_mask);
+        TEST_CHECK_EQUAL(Image_Ptr->den, Test_PeekPortReg(Port, PORT_DIGITAL_ENABLE_REG_OFFSET) & Image_Ptr->pins_mask);
+        TEST_CHECK_EQUAL(Image_Ptr->afsel, Test_PeekPortReg(Port, PORT_ALT_FUNC_REG_OFFSET) & Image_Ptr->pins_mask);
+        TEST_CHECK_EQUAL(Image_Ptr->amsel, Test_PeekPortReg(Port, PORT_ANALOG_MODE_SEL_REG_OFFSET) & Image_Ptr->pins_mask);
+        TEST_CHECK_EQUAL(Image_Ptr->pur, Test_PeekPortReg(Port, PORT_PULL_UP_REG_OFFSET) & Image_Ptr->pins_mask);
+        TEST_CHECK_EQUAL(Image_Ptr->pdr, Test_PeekPortReg(Port, PORT_PULL_DOWN_REG_OFFSET) & Image_Ptr->pins_mask);
+        TEST_CHECK_EQUAL(Image_Ptr->pctl, Test_PeekPortReg(Port, PORT_CTL_REG_OFFSET) & Image_Ptr->pctl_mask);
+        TEST_CHECK_EQUAL(Image_Ptr->data, Test_PeekPortReg(Port, PORT_DATA_REG_OFFSET) & Image_Ptr->pins_mask);
+        TEST_CHECK_EQUAL(Image_Ptr->commit_mask, Test_PeekPortReg(Port, PORT_COMMIT_REG_OFFSET) & Image_Ptr->commit_mask);
+    }
+}
+
+int main(void)
+{
+    Sim_Init();
+
+    TEST_RUN(Test_ImagesEqual);
+    TEST_RUN(Test_RegistersMatchImages);
+
+    return TEST_RESULT();
+}
@@ -0,0 +1,23 @@
+ /******************************************************************************
+ *
+ * Module: Test
+ *
+ * File Name: Test_PortImages.h
+ *
+ * Description: Access to the interpreted Port driver from the precomputed image tests.
+ *
+ * Author: Tarek Emad
+ ******************************************************************************/
+
+#ifndef TEST_PORT_IMAGES_H
+#define TEST_PORT_IMAGES_H
+
+#include "Port.h"
+
+/* Register images computed at run time by Port_BuildRegisterImages from the pins */
+void Test_BuildInterpretedImages(const Port_ConfigChannel *Channels, Port_RegisterImageType *Images);
+
+/* Port_Init of the interpreted driver with the given pins */
+void Test_InterpretedPortInit(const Port_ConfigChannel *Channels);
+
+#endif /* TEST_PORT_IMAGES_H */
@@ -0,0 +1,47 @@
+ /******************************************************************************
+ *
+ * Module: Test
+ *
+ * File Name: Test_PortImages_Interpreted.c
+ *
+ * Description: Port driver built with PORT_PRECOMPUTED_REGISTER_IMAGES = STD_OFF,
+ *              so Port_Init computes the register images from the pins at run time.
+ *
+ * Author: Tarek Emad
+ ******************************************************************************/
+
+#include "Port.c"
+#include "Test_PortImages.h"
+
+/* Configuration of the interpreted driver built from the pins of the precomputed one */
+static void Test_GetInterpretedConfig(const Port_ConfigChannel *Channels, Port_ConfigType *ConfigPtr)
+{
+    uint8 Channel;
+
+    for (Channel = 0; Channel < PORT_CONFIGURED_PINS; Channel++)
+    {
+        ConfigPtr->Channels[Channel] = Channels[Channel];
+    }
+}
+
+void Test_BuildInterpretedImages(const Port_ConfigChannel *Channels, Port_RegisterImageType *Images)
+{
+    Port_ConfigType Config;
+    uint8 Port;
+
+    Test_GetInterpretedConfig(Channels, &Config);
+    Port_BuildRegisterImages(&Config);
+    for (Port = 0; Port < PORT_NUMBER_OF_PORTS; Port++)
+    {
+        Images[Port] = Port_RegisterImages[Port];
+    }
+}
+
+void Test_InterpretedPortInit(const Port_ConfigChannel *Channels)
+{
+    /* Port_Init keeps the configuration pointer */
+    static Port_ConfigType Config;
+
+    Test_GetInterpretedConfig(Channels, &Config);
+    Port_Init(&Config);
+}
@@ -0,0 +1,174 @@
+ /******************************************************************************
+ *
+ * Module: Test
+ *
+ * File Name: Test_PortRefresh.c
+ *
+ * Description: Direction refresh of Port_RefreshPortDirection and its drift report on the
+ *              register simulator. Built with the pins of Port_TestPins.h: PB3 and PF2 are
+ *              refreshed, PC1 (JTAG) is never touched even with its direction not changeable.
+ *
+ * Author: Tarek Emad
+ ******************************************************************************/
+
+#include "Test.h"
+#include "Sim.h"
+#include "Det_Stub.h"
+#include "Port.h"
+
+/* GPIODIR of the ports used by Port_Init (only PORTF is moved to AHB) */
+#define TEST_PORTA_DIR       (0x40004000U + PORT_DIR_REG_OFFSET)
+#define TEST_PORTB_DIR       (0x40005000U + PORT_DIR_REG_OFFSET)
+#define TEST_PORTC_DIR       (0x40006000U + PORT_DIR_REG_OFFSET)
+#define TEST_PORTF_DIR       (0x4005D000U + PORT_DIR_REG_OFFSET)
+
+/* Ports with refreshed pins */
+#define TEST_PORTB           (1U)
+#define TEST_PORTF           (5U)
+
+/* Number of reads and writes of a register since the last counters reset */
+static void Test_CountAccesses(uint32 Address, uint32 *Reads, uint32 *Writes)
+{
+    Sim_TraceType Access;
+    uint32 Index;
+
+    *Reads = 0;
+    *Writes = 0;
+    for (Index = 0; Sim_GetTrace(Index, &Access) == E_OK; Index++)
+    {
+        if (Access.Address == Address)
+        {
+            if (Access.Write == TRUE)
+            {
+                (*Writes)++;
+            }
+            else
+            {
+                (*Reads)++;
+            }
+        }
+    }
+}
+
+/* Number of pins reported by Port_GetDirectionDrift out of the expected ones */
+static uint8 Test_DriftOutside(const Port_DirectionDriftType *Drift, uint8 PortB_Mask, uint8 PortF_Mask)
+{
+    uint8 Port;
+    uint8 Unexpected = 0;
+
+    for (Port = 0; Port < PORT_NUMBER_OF_PORTS; Port++)
+    {
+        uint8 Expected = (Port == TEST_PORTB) ? PortB_Mask : ((Port == TEST_PORTF) ? PortF_Mask : 0U);
+
+        if (Drift->DriftMask[Port] != Expected)
+        {
+            Unexpected++;
+        }
+    }
+    return Unexpected;
+}
+
+static void Test_Setup(void)
+{
+    Sim_Reset();
+    Port_Init(&Port_Configuration);
+    Det_StubReset();
+    Sim_ResetCounters();
+}
+
+/* Without drift each port with refreshed pins is read once and nothing is written */
+static void Test_Undrifted(void)
+{
+    Port_DirectionDriftType Drift;
+    Sim_CountersType Counters;
+    uint32 Reads;
+    uint32 Writes;
+
+    Test_Setup();
+    Port_RefreshPortDirection();
+    Sim_GetCounters(&Counters);
+
+    TEST_CHECK_EQUAL(2U, Counters.Reads);
+    TEST_CHECK_EQUAL(0U, Counters.Writes);
+    Test_CountAccesses(TEST_PORTB_DIR, &Reads, &Writes);
+    TEST_CHECK_EQUAL(1U, Reads);
+    Test_CountAccesses(TEST_PORTF_DIR, &Reads, &Writes);
+    TEST_CHECK_EQUAL(1U, Reads);
+
+    Port_GetDirectionDrift(&Drift);
+    TEST_CHECK_EQUAL(0U, Test_DriftOutside(&Drift, 0U, 0U));
+    TEST_CHECK_EQUAL(0U, Det_StubGetCount());
+}
+
+/*
+ * PB3 drifted to output and PF2 to input are flipped back with one GPIODIR write per port,
+ * the drifted changeable pins (PA1, PC6) and PC0 - PC3 are left alone, the drift report
+ * holds exactly PB3 and PF2 and is cleared by the next refresh
+ */
+static void Test_Drifted(void)
+{
+    Port_DirectionDriftType Drift;
+    Sim_CountersType Counters;
+    uint32 Reads;
+    uint32 Writes;
+
+    Test_Setup();
+    Sim_Poke(TEST_PORTB_DIR, Sim_Peek(TEST_PORTB_DIR) | 0x08U);
+    Sim_Poke(TEST_PORTF_DIR, Sim_Peek(TEST_PORTF_DIR) & ~0x04U);
+    Sim_Poke(TEST_PORTA_DIR, Sim_Peek(TEST_PORTA_DIR) & ~0x02U);
+    Sim_Poke(TEST_PORTC_DIR, (Sim_Peek(TEST_PORTC_DIR) & ~0x40U) | 0x0FU);
+
+    Port_RefreshPortDirection();
+    Sim_GetCounters(&Counters);
+
+    TEST_CHECK_EQUAL(0U, Sim_Peek(TEST_PORTB_DIR) & 0x08U);
+    TEST_CHECK_EQUAL(0x04U, Sim_Peek(TEST_PORTF_DIR) & 0x04U);
+    TEST_CHECK_EQUAL(0U, Sim_Peek(TEST_PORTA_DIR) & 0x02U);
+    TEST_CHECK_EQUAL(0x0FU, Sim_Peek(TEST_PORTC_DIR) & 0x4FU);
+
+    TEST_CHECK_EQUAL(2U, Counters.Writes);
+    Test_CountAccesses(TEST_PORTB_DIR, &Reads, &Writes);
+    TEST_CHECK_EQUAL(1U, Reads);
+    TEST_CHECK_EQUAL(1U, Writes);
+    Test_CountAccesses(TEST_PORTF_DIR, &Reads, &Writes);
+    TEST_CHECK_EQUAL(1U, Reads);
+    TEST_CHECK_EQUAL(1U, Writes);
+    Test_CountAccesses(TEST_PORTC_DIR, &Reads, &Writes);
+    TEST_CHECK_EQUAL(0U, Reads + Writes);
+
+    Port_GetDirectionDrift(&Drift);
+    TEST_CHECK_EQUAL(0U, Test_DriftOutside(&Drift, 0x08U, 0x04U));
+
+    Sim_ResetCounters();
+    Port_RefreshPortDirection();
+    Sim_GetCounters(&Counters);
+    Port_GetDirectionDrift(&Drift);
+    TEST_CHECK_EQUAL(0U, Counters.Writes);
+    TEST_CHECK_EQUAL(0U, Test_DriftOutside(&Drift, 0U, 0U));
+    TEST_CHECK_EQUAL(0U, Det_StubGetCount());
+}
+
+/* A null pointer is reported to Det */
+static void Test_DriftNullPointer(void)
+{
+    Det_StubErrorType Error;
+
+    Test_Setup();
+    Port_GetDirectionDrift(NULL_PTR);
+    Det_StubGetLast(&Error);
+
+    TEST_CHECK_EQUAL(1U, Det_StubGetCount());
+    TEST_CHECK_EQUAL(PORT_E_PARAM_POINTER, Error.ErrorId);
+    TEST_CHECK_EQUAL(PORT_GET_DIRECTION_DRIFT_SID, Error.ApiId);
+}
+
+int main(void)
+{
+    Sim_Init();
+
+    TEST_RUN(Test_Undrifted);
+    TEST_RUN(Test_Drifted);
+    TEST_RUN(Test_DriftNullPointer);
+
+    return TEST_RESULT();
+}
@@ -0,0 +1,284 @@
+ /******************************************************************************
+ *
+ * Module: Test
+ *
+ * File Name: Test_PortSetPinMode.c
+ *
+ * Description: Runtime mode switches of Port_SetPinMode and Port_SetPinsModeMasked on the
+ *              register simulator: PMCx programming, GPIOCR commit of the locked pins, write
+ *              order and cost. Built with the pins of Port_TestPins.h.
+ *
+ * Author: Tarek Emad
+ ******************************************************************************/
+
+#include "Test.h"
+#include "Bench.h"
+#include "Sim.h"
+#include "Det_Stub.h"
+#include "Port.h"
+
+/* Pin Ids in Port_TestPins.h */
+#define TEST_PA1_PIN_ID      ((Port_PinType)1)
+#define TEST_PC6_PIN_ID      ((Port_PinType)4)
+#define TEST_PE3_PIN_ID      ((Port_PinType)6) /* mode unchangeable */
+#define TEST_PF0_PIN_ID      ((Port_PinType)8) /* locked */
+
+/* Port Ids */
+#define TEST_PORTA           ((Port_PortType)0)
+#define TEST_PORTB           ((Port_PortType)1)
+#define TEST_PORTC           ((Port_PortType)2)
+#define TEST_PORTD           ((Port_PortType)3)
+#define TEST_PORTE           ((Port_PortType)4)
+#define TEST_PORTF           ((Port_PortType)5)
+
+/* Base addresses of the ports used by Port_Init (only PORTF is moved to AHB) */
+#define TEST_PORTA_BASE      (0x40004000U)
+#define TEST_PORTC_BASE      (0x40006000U)
+#define TEST_PORTD_BASE      (0x40007000U)
+#define TEST_PORTF_BASE      (0x4005D000U)
+
+#define TEST_NO_WRITE        (0xFFFFFFFFU)
+
+/* Trace index of the last write to a register since the last counters reset, TEST_NO_WRITE if none */
+static uint32 Test_LastWrite(uint32 Address)
+{
+    Sim_TraceType Access;
+    uint32 Index;
+    uint32 Found = TEST_NO_WRITE;
+
+    for (Index = 0; Sim_GetTrace(Index, &Access) == E_OK; Index++)
+    {
+        if ((Access.Write == TRUE) && (Access.Address == Address))
+        {
+            Found = Index;
+        }
+    }
+    return Found;
+}
+
+static void Test_Setup(void)
+{
+    Sim_Reset();
+    Port_Init(&Port_Configuration);
+    Det_StubReset();
+    Sim_ResetCounters();
+}
+
+/* PA1 from UART (ALT1) to DIO and to ALT2: PMCx follows the mode, the peripheral is selected before it is routed */
+static void Test_AltToDioAndBack(void)
+{
+    Test_Setup();
+    TEST_CHECK_EQUAL(0x10U, Sim_Peek(TEST_PORTA_BASE + PORT_CTL_REG_OFFSET) & 0xF0U);
+
+    Port_SetPinMode(TEST_PA1_PIN_ID, PORT_PIN_MODE_DIO);
+    TEST_CHECK_EQUAL(0U, Sim_Peek(TEST_PORTA_BASE + PORT_ALT_FUNC_REG_OFFSET) & 0x02U);
+    TEST_CHECK_EQUAL(0U, Sim_Peek(TEST_PORTA_BASE + PORT_CTL_REG_OFFSET) & 0xF0U);
+    TEST_CHECK_EQUAL(0x02U, Sim_Peek(TEST_PORTA_BASE + PORT_DIGITAL_ENABLE_REG_OFFSET) & 0x02U);
+    /* PA0 keeps its UART function */
+    TEST_CHECK_EQUAL(0x01U, Sim_Peek(TEST_PORTA_BASE + PORT_ALT_FUNC_REG_OFFSET) & 0x01U);
+    TEST_CHECK_EQUAL(0x01U, Sim_Peek(TEST_PORTA_BASE + PORT_CTL_REG_OFFSET) & 0x0FU);
+
+    Sim_ResetCounters();
+    Port_SetPinMode(TEST_PA1_PIN_ID, PORT_PIN_MODE_ALT2);
+    TEST_CHECK_EQUAL(0x02U, Sim_Peek(TEST_PORTA_BASE + PORT_ALT_FUNC_REG_OFFSET) & 0x02U);
+    TEST_CHECK_EQUAL(0x20U, Sim_Peek(TEST_PORTA_BASE + PORT_CTL_REG_OFFSET) & 0xF0U);
+    TEST_CHECK(Test_LastWrite(TEST_PORTA_BASE + PORT_CTL_REG_OFFSET) < Test_LastWrite(TEST_PORTA_BASE + PORT_ALT_FUNC_REG_OFFSET));
+    TEST_CHECK(Test_LastWrite(TEST_PORTA_BASE + PORT_ALT_FUNC_REG_OFFSET) < Test_LastWrite(TEST_PORTA_BASE + PORT_DIGITAL_ENABLE_REG_OFFSET));
+    TEST_CHECK_EQUAL(0U, Det_StubGetCount());
+}
+
+/* PC6 to analog: the digital path is disabled before the analog one is enabled, the JTAG pins are untouched */
+static void Test_ToAnalog(void)
+{
+    Test_Setup();
+    Port_SetPinMode(TEST_PC6_PIN_ID, PORT_PIN_MODE_ADC);
+
+    TEST_CHECK_EQUAL(0U, Sim_Peek(TEST_PORTC_BASE + PORT_DIGITAL_ENABLE_REG_OFFSET) & 0x40U);
+    TEST_CHECK_EQUAL(0x40U, Sim_Peek(TEST_PORTC_BASE + PORT_ANALOG_MODE_SEL_REG_OFFSET) & 0x40U);
+    TEST_CHECK(Test_LastWrite(TEST_PORTC_BASE + PORT_DIGITAL_ENABLE_REG_OFFSET) < Test_LastWrite(TEST_PORTC_BASE + PORT_ANALOG_MODE_SEL_REG_OFFSET));
+    TEST_CHECK_EQUAL(0x0FU, Sim_Peek(TEST_PORTC_BASE + PORT_ALT_FUNC_REG_OFFSET) & 0x0FU);
+    TEST_CHECK_EQUAL(0x1111U, Sim_Peek(TEST_PORTC_BASE + PORT_CTL_REG_OFFSET) & 0xFFFFU);
+}
+
+/* PF0 is committed through GPIOCR and GPIOLOCK is locked again */
+static void Test_LockedPin(void)
+{
+    Sim_CountersType Counters;
+
+    Test_Setup();
+    Port_SetPinMode(TEST_PF0_PIN_ID, PORT_PIN_MODE_ALT3);
+    Sim_GetCounters(&Counters);
+
+    TEST_CHECK_EQUAL(0x01U, Sim_Peek(TEST_PORTF_BASE + PORT_ALT_FUNC_REG_OFFSET) & 0x01U);
+    TEST_CHECK_EQUAL(0x03U, Sim_Peek(TEST_PORTF_BASE + PORT_CTL_REG_OFFSET) & 0x0FU);
+    TEST_CHECK_EQUAL(0x01U, Sim_Peek(TEST_PORTF_BASE + PORT_DIGITAL_ENABLE_REG_OFFSET) & 0x01U);
+    TEST_CHECK_EQUAL(0x01U, Sim_Peek(TEST_PORTF_BASE + PORT_COMMIT_REG_OFFSET) & 0x01U);
+    TEST_CHECK_EQUAL(1U, Sim_Peek(TEST_PORTF_BASE + PORT_LOCK_REG_OFFSET));
+    TEST_CHECK_EQUAL(0U, Counters.Commit_Violations);
+    TEST_CHECK_EQUAL(0U, Counters.Lock_Violations);
+}
+
+/* Rejected switches report to Det and do not touch the registers */
+static void Test_Errors(void)
+{
+    Sim_CountersType Counters;
+    Det_StubErrorType Error;
+
+    Test_Setup();
+    Port_SetPinMode(TEST_PE3_PIN_ID, PORT_PIN_MODE_DIO);
+    Det_StubGetLast(&Error);
+    TEST_CHECK_EQUAL(PORT_E_MODE_UNCHANGEABLE, Error.ErrorId);
+
+    Port_SetPinMode(TEST_PA1_PIN_ID, (Port_PinModeType)(PORT_PIN_MODE_DIO + 1U));
+    Det_StubGetLast(&Error);
+    TEST_CHECK_EQUAL(PORT_E_PARAM_INVALID_MODE, Error.ErrorId);
+    TEST_CHECK_EQUAL(PORT_SET_PIN_MODE_SID, Error.ApiId);
+
+    /* An unconfigured pin is only reported as such, its channel is never read */
+    Det_StubReset();
+    Port_SetPinMode((Port_PinType)PORT_CONFIGURED_PINS, PORT_PIN_MODE_DIO);
+    Det_StubGetLast(&Error);
+    TEST_CHECK_EQUAL(1U, Det_StubGetCount());
+    TEST_CHECK_EQUAL(PORT_E_PARAM_PIN, Error.ErrorId);
+
+    Det_StubReset();
+    Port_SetPinDirection((Port_PinType)PORT_CONFIGURED_PINS, OUTPUT);
+    Det_StubGetLast(&Error);
+    TEST_CHECK_EQUAL(1U, Det_StubGetCount());
+    TEST_CHECK_EQUAL(PORT_E_PARAM_PIN, Error.ErrorId);
+    TEST_CHECK_EQUAL(PORT_SET_PIN_DIRECTION_SID, Error.ApiId);
+
+    Sim_GetCounters(&Counters);
+    TEST_CHECK_EQUAL(0U, Counters.Writes);
+}
+
+/* PA0 and PA1 (UART) to DIO inputs: GPIODIR is cleared before the mode switch, PCTL only changes their nibbles */
+static void Test_MaskedToInput(void)
+{
+    Test_Setup();
+    Sim_Poke(TEST_PORTA_BASE + PORT_CTL_REG_OFFSET, 0x76543211U);
+    Sim_Poke(TEST_PORTA_BASE + PORT_DIR_REG_OFFSET, 0x03U);
+
+    Port_SetPinsModeMasked(TEST_PORTA, 0x03U, PORT_PIN_MODE_DIO, INPUT);
+
+    TEST_CHECK_EQUAL(0U, Det_StubGetCount());
+    TEST_CHECK_EQUAL(0U, Sim_Peek(TEST_PORTA_BASE + PORT_DIR_REG_OFFSET) & 0x03U);
+    TEST_CHECK_EQUAL(0U, Sim_Peek(TEST_PORTA_BASE + PORT_ALT_FUNC_REG_OFFSET) & 0x03U);
+    TEST_CHECK_EQUAL(0x03U, Sim_Peek(TEST_PORTA_BASE + PORT_DIGITAL_ENABLE_REG_OFFSET) & 0x03U);
+    TEST_CHECK_EQUAL(0x76543200U, Sim_Peek(TEST_PORTA_BASE + PORT_CTL_REG_OFFSET));
+    TEST_CHECK(Test_LastWrite(TEST_PORTA_BASE + PORT_DIR_REG_OFFSET) < Test_LastWrite(TEST_PORTA_BASE + PORT_ANALOG_MODE_SEL_REG_OFFSET));
+    TEST_CHECK(Test_LastWrite(TEST_PORTA_BASE + PORT_DIR_REG_OFFSET) < Test_LastWrite(TEST_PORTA_BASE + PORT_CTL_REG_OFFSET));
+    TEST_CHECK(Test_LastWrite(TEST_PORTA_BASE + PORT_DIR_REG_OFFSET) < Test_LastWrite(TEST_PORTA_BASE + PORT_ALT_FUNC_REG_OFFSET));
+    TEST_CHECK(Test_LastWrite(TEST_PORTA_BASE + PORT_ALT_FUNC_REG_OFFSET) < Test_LastWrite(TEST_PORTA_BASE + PORT_DIGITAL_ENABLE_REG_OFFSET));
+}
+
+/* PF0 (locked) and PF3 to ALT3 outputs: PF0 is committed, GPIODIR is set after GPIODEN, GPIOLOCK is locked again */
+static void Test_MaskedToOutputLocked(void)
+{
+    Sim_CountersType Counters;
+
+    Test_Setup();
+    Port_SetPinsModeMasked(TEST_PORTF, 0x09U, PORT_PIN_MODE_ALT3, OUTPUT);
+    Sim_GetCounters(&Counters);
+
+    TEST_CHECK_EQUAL(0U, Det_StubGetCount());
+    TEST_CHECK_EQUAL(0x09U, Sim_Peek(TEST_PORTF_BASE + PORT_DIR_REG_OFFSET) & 0x09U);
+    TEST_CHECK_EQUAL(0x09U, Sim_Peek(TEST_PORTF_BASE + PORT_ALT_FUNC_REG_OFFSET) & 0x09U);
+    TEST_CHECK_EQUAL(0x09U, Sim_Peek(TEST_PORTF_BASE + PORT_DIGITAL_ENABLE_REG_OFFSET) & 0x09U);
+    /* PF2 keeps its ALT14 nibble */
+    TEST_CHECK_EQUAL(0x3E03U, Sim_Peek(TEST_PORTF_BASE + PORT_CTL_REG_OFFSET) & 0xFFFFU);
+    TEST_CHECK(Test_LastWrite(TEST_PORTF_BASE + PORT_DIGITAL_ENABLE_REG_OFFSET) < Test_LastWrite(TEST_PORTF_BASE + PORT_DIR_REG_OFFSET));
+    TEST_CHECK(Test_LastWrite(TEST_PORTF_BASE + PORT_COMMIT_REG_OFFSET) < Test_LastWrite(TEST_PORTF_BASE + PORT_CTL_REG_OFFSET));
+    TEST_CHECK(Test_LastWrite(TEST_PORTF_BASE + PORT_DIR_REG_OFFSET) < Test_LastWrite(TEST_PORTF_BASE + PORT_LOCK_REG_OFFSET));
+    TEST_CHECK_EQUAL(0x01U, Sim_Peek(TEST_PORTF_BASE + PORT_COMMIT_REG_OFFSET) & 0x01U);
+    TEST_CHECK_EQUAL(1U, Sim_Peek(TEST_PORTF_BASE + PORT_LOCK_REG_OFFSET));
+    TEST_CHECK_EQUAL(0U, Counters.Commit_Violations);
+    TEST_CHECK_EQUAL(0U, Counters.Lock_Violations);
+}
+
+/* PD7 (locked) to a DIO output through the unchecked variant: same commit, order and relock */
+static void Test_MaskedFastLocked(void)
+{
+    Sim_CountersType Counters;
+
+    Test_Setup();
+    Port_SetPinsModeMasked_Fast(TEST_PORTD, 0x80U, PORT_PIN_MODE_DIO, OUTPUT);
+    Sim_GetCounters(&Counters);
+
+    TEST_CHECK_EQUAL(0x80U, Sim_Peek(TEST_PORTD_BASE + PORT_DIR_REG_OFFSET) & 0x80U);
+    TEST_CHECK_EQUAL(0x80U, Sim_Peek(TEST_PORTD_BASE + PORT_DIGITAL_ENABLE_REG_OFFSET) & 0x80U);
+    TEST_CHECK_EQUAL(0U, Sim_Peek(TEST_PORTD_BASE + PORT_CTL_REG_OFFSET) & 0xF0000000U);
+    TEST_CHECK(Test_LastWrite(TEST_PORTD_BASE + PORT_DIGITAL_ENABLE_REG_OFFSET) < Test_LastWrite(TEST_PORTD_BASE + PORT_DIR_REG_OFFSET));
+    TEST_CHECK(Test_LastWrite(TEST_PORTD_BASE + PORT_DIR_REG_OFFSET) < Test_LastWrite(TEST_PORTD_BASE + PORT_LOCK_REG_OFFSET));
+    TEST_CHECK_EQUAL(0x80U, Sim_Peek(TEST_PORTD_BASE + PORT_COMMIT_REG_OFFSET) & 0x80U);
+    TEST_CHECK_EQUAL(1U, Sim_Peek(TEST_PORTD_BASE + PORT_LOCK_REG_OFFSET));
+    TEST_CHECK_EQUAL(0U, Counters.Commit_Violations);
+    TEST_CHECK_EQUAL(0U, Counters.Lock_Violations);
+}
+
+/* Check that a masked switch is rejected with one Det error and touches no register */
+static void Test_MaskedRejected(Port_PortType Port, uint8 PinsMask, uint8 ErrorId)
+{
+    Sim_CountersType Counters;
+    Det_StubErrorType Error;
+
+    Det_StubReset();
+    Sim_ResetCounters();
+    Port_SetPinsModeMasked(Port, PinsMask, PORT_PIN_MODE_DIO, OUTPUT);
+    Sim_GetCounters(&Counters);
+    Det_StubGetLast(&Error);
+
+    TEST_CHECK_EQUAL(1U, Det_StubGetCount());
+    TEST_CHECK_EQUAL(ErrorId, Error.ErrorId);
+    TEST_CHECK_EQUAL(PORT_SET_PINS_MODE_MASKED_SID, Error.ApiId);
+    TEST_CHECK_EQUAL(0U, Counters.Writes);
+}
+
+/* Masks with an unconfigured, a JTAG, another port's or a non-changeable pin are rejected */
+static void Test_MaskedErrors(void)
+{
+    Test_Setup();
+    Test_MaskedRejected(TEST_PORTA, 0x07U, PORT_E_PARAM_PIN);              /* PA2 not configured */
+    Test_MaskedRejected(TEST_PORTC, 0x42U, PORT_E_PARAM_PIN);              /* PC1 JTAG */
+    Test_MaskedRejected(TEST_PORTB, 0x48U, PORT_E_PARAM_PIN);              /* pin 6 is PC6 */
+    Test_MaskedRejected(TEST_PORTB, 0x08U, PORT_E_DIRECTION_UNCHANGEABLE); /* PB3 */
+    Test_MaskedRejected(TEST_PORTE, 0x18U, PORT_E_MODE_UNCHANGEABLE);      /* PE3 */
+    Test_MaskedRejected(TEST_PORTF, 0x04U, PORT_E_DIRECTION_UNCHANGEABLE); /* PF2 */
+    Test_MaskedRejected(TEST_PORTA, 0x00U, PORT_E_PARAM_PIN);
+    Test_MaskedRejected((Port_PortType)PORT_NUMBER_OF_PORTS, 0x01U, PORT_E_PARAM_PIN);
+}
+
+/* Cost of a runtime switch of an ordinary pin and of a locked pin */
+static void Test_SwitchCost(void)
+{
+    Bench_ResultType Pin_Switch, Locked_Switch;
+
+    Test_Setup();
+    BENCH_MEASURE(Pin_Switch, Port_SetPinMode_Fast(TEST_PA1_PIN_ID, PORT_PIN_MODE_DIO));
+    BENCH_MEASURE(Locked_Switch, Port_SetPinMode_Fast(TEST_PF0_PIN_ID, PORT_PIN_MODE_ALT3));
+    BENCH_PRINT("Port_SetPinMode_Fast PA1 ALT1 -> DIO", Pin_Switch);
+    BENCH_PRINT("Port_SetPinMode_Fast PF0 DIO -> ALT3", Locked_Switch);
+
+    /* Four read-modify-writes, plus GPIOLOCK twice and a GPIOCR read-modify-write for a locked pin */
+    TEST_CHECK_EQUAL(4U, Pin_Switch.Writes);
+    TEST_CHECK_EQUAL(4U, Pin_Switch.Reads);
+    TEST_CHECK_EQUAL(7U, Locked_Switch.Writes);
+    TEST_CHECK_EQUAL(5U, Locked_Switch.Reads);
+}
+
+int main(void)
+{
+    Sim_Init();
+
+    TEST_RUN(Test_AltToDioAndBack);
+    TEST_RUN(Test_ToAnalog);
+    TEST_RUN(Test_LockedPin);
+    TEST_RUN(Test_Errors);
+    TEST_RUN(Test_MaskedToInput);
+    TEST_RUN(Test_MaskedToOutputLocked);
+    TEST_RUN(Test_MaskedFastLocked);
+    TEST_RUN(Test_MaskedErrors);
+    TEST_RUN(Test_SwitchCost);
+
+    return TEST_RESULT();
+}
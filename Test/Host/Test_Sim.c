@@ -0,0 +1,225 @@
+ /******************************************************************************
+ *
+ * Module: Test
+ *
+ * File Name: Test_Sim.c
+ *
+ * Description: Unit tests of the register simulator: GPIOLOCK/GPIOCR commit,
+ *              masked GPIODATA alias, RCGCGPIO/PRGPIO readiness and bit-band alias.
+ *
+ * Author: Tarek Emad
+ ******************************************************************************/
+
+#include "Test.h"
+#include "Sim.h"
+#include "Port.h"
+#include "tm4c123gh6pm_registers.h"
+
+/* GPIODATA alias of PORTF (APB aperture) that only sees the lanes in MASK */
+#define TEST_PORTF_DATA(MASK)   (*HW_REGISTER_ADDRESS(0x40025000U + ((uint32)(MASK) << 2)))
+
+/* Enable the clock of PORTF and wait until it is ready */
+static void Test_EnablePortF(void)
+{
+    SYSCTL_RCGCGPIO_REG |= 0x20U;
+    while((SYSCTL_PRGPIO_REG & 0x20U) == 0U);
+}
+
+/* PF0 is protected: its GPIODEN bit only changes once GPIOCR is unlocked and committed */
+static void Test_UnlockCommit(void)
+{
+    Sim_CountersType Counters;
+
+    Sim_Reset();
+    Test_EnablePortF();
+
+    TEST_CHECK_EQUAL(1U, GPIO_PORTF_LOCK_REG);
+    TEST_CHECK_EQUAL(0xFEU, GPIO_PORTF_CR_REG);
+
+    /* Locked: the PF0 bit is dropped, the other pins are not protected */
+    GPIO_PORTF_DEN_REG |= 0x03U;
+    TEST_CHECK_EQUAL(0x02U, GPIO_PORTF_DEN_REG);
+    GPIO_PORTF_CR_REG |= 0x01U;
+    TEST_CHECK_EQUAL(0xFEU, GPIO_PORTF_CR_REG);
+    Sim_GetCounters(&Counters);
+    TEST_CHECK_EQUAL(1U, Counters.Commit_Violations);
+    TEST_CHECK_EQUAL(1U, Counters.Lock_Violations);
+
+    /* Unlocked and committed */
+    GPIO_PORTF_LOCK_REG = SIM_GPIO_UNLOCK_KEY;
+    TEST_CHECK_EQUAL(0U, GPIO_PORTF_LOCK_REG);
+    GPIO_PORTF_CR_REG |= 0x01U;
+    TEST_CHECK_EQUAL(0xFFU, GPIO_PORTF_CR_REG);
+    GPIO_PORTF_DEN_REG |= 0x01U;
+    GPIO_PORTF_PUR_REG |= 0x01U;
+    TEST_CHECK_EQUAL(0x03U, GPIO_PORTF_DEN_REG);
+    TEST_CHECK_EQUAL(0x01U, GPIO_PORTF_PUR_REG);
+
+    /* Any other value locks again, the commit stays until GPIOCR is cleared */
+    GPIO_PORTF_LOCK_REG = 0U;
+    TEST_CHECK_EQUAL(1U, GPIO_PORTF_LOCK_REG);
+    GPIO_PORTF_CR_REG &= ~0x01U;
+    TEST_CHECK_EQUAL(0xFFU, GPIO_PORTF_CR_REG);
+
+    Sim_GetCounters(&Counters);
+    TEST_CHECK_EQUAL(1U, Counters.Commit_Violations);
+    TEST_CHECK_EQUAL(2U, Counters.Lock_Violations);
+    TEST_CHECK_EQUAL(0U, Counters.Clock_Violations);
+
+    /* The JTAG pins keep their alternative function without a commit */
+    SYSCTL_RCGCGPIO_REG |= 0x04U;
+    while((SYSCTL_PRGPIO_REG & 0x04U) == 0U);
+    GPIO_PORTC_AFSEL_REG = 0U;
+    TEST_CHECK_EQUAL(0x0FU, GPIO_PORTC_AFSEL_REG);
+}
+
+/* Bits [9:2] of the GPIODATA address select the lanes seen by the access */
+static void Test_MaskedAlias(void)
+{
+    Sim_CountersType Counters;
+
+    Sim_Reset();
+    Test_EnablePortF();
+    GPIO_PORTF_DIR_REG = 0x0EU;
+    GPIO_PORTF_DEN_REG = 0x1EU;
+
+    Sim_ResetCounters();
+    TEST_PORTF_DATA(0x02U) = 0xFFU;
+    TEST_CHECK_EQUAL(0x02U, Sim_GetPinLevels(5U));
+    Sim_GetCounters(&Counters);
+    TEST_CHECK_EQUAL(0U, Counters.Reads);
+    TEST_CHECK_EQUAL(1U, Counters.Writes);
+    TEST_CHECK_EQUAL(SIM_APB_ACCESS_CYCLES, Counters.Bus_Cycles);
+
+    TEST_PORTF_DATA(0x0CU) = 0x04U;
+    TEST_CHECK_EQUAL(0x06U, Sim_GetPinLevels(5U));
+    TEST_PORTF_DATA(0x0CU) = 0x08U;
+    TEST_CHECK_EQUAL(0x0AU, Sim_GetPinLevels(5U));
+
+    /* Reads only return the selected lanes, the inputs return their driven level */
+    TEST_CHECK_EQUAL(0x08U, TEST_PORTF_DATA(0x0CU));
+    TEST_CHECK_EQUAL(0U, TEST_PORTF_DATA(0x10U));
+    Sim_DriveInputs(5U, 0x10U, 0x10U);
+    TEST_CHECK_EQUAL(0x10U, TEST_PORTF_DATA(0x10U));
+    TEST_CHECK_EQUAL(0x1AU, GPIO_PORTF_DATA_REG);
+
+    /* Writing an input lane only changes the output latch */
+    TEST_PORTF_DATA(0x10U) = 0U;
+    TEST_CHECK_EQUAL(0x10U, TEST_PORTF_DATA(0x10U));
+}
+
+/* A port is only accessible once PRGPIO reports it ready */
+static void Test_PrgpioReadiness(void)
+{
+    Sim_CountersType Counters;
+    uint32 Polls = 0;
+
+    Sim_Reset();
+    Sim_SetPrgpioDelay(3U);
+    SYSCTL_RCGCGPIO_REG |= 0x20U;
+    GPIO_PORTF_DIR_REG = 0x02U; /* Too early */
+    do
+    {
+        Polls++;
+    } while((SYSCTL_PRGPIO_REG & 0x20U) == 0U);
+    TEST_CHECK_EQUAL(4U, Polls);
+    GPIO_PORTF_DIR_REG = 0x02U;
+
+    Sim_GetCounters(&Counters);
+    TEST_CHECK_EQUAL(1U, Counters.Clock_Violations);
+
+    /* Disabling the clock makes the port not ready at once */
+    SYSCTL_RCGCGPIO_REG &= ~0x20U;
+    TEST_CHECK_EQUAL(0U, SYSCTL_PRGPIO_REG & 0x20U);
+
+    /* Port_Init waits for the ports it enables and moves PORTF to its AHB aperture first */
+    Sim_Reset();
+    Sim_SetPrgpioDelay(5U);
+    Port_Init(&Port_Configuration);
+    Sim_GetCounters(&Counters);
+    TEST_CHECK_EQUAL(0U, Counters.Clock_Violations);
+    TEST_CHECK_EQUAL(0U, Counters.Aperture_Violations);
+    TEST_CHECK_EQUAL(0U, Counters.Commit_Violations);
+    TEST_CHECK_EQUAL(0x20U, SYSCTL_PRGPIO_REG & 0x20U);
+    TEST_CHECK_EQUAL(0x0EU, GPIO_PORTF_DIR_REG & 0x1EU);
+    TEST_CHECK_EQUAL(0x1EU, GPIO_PORTF_DEN_REG & 0x1EU);
+}
+
+/* Each word of the bit-band alias reads and writes one bit of its target register */
+static void Test_Bitband(void)
+{
+    Sim_CountersType Counters;
+    volatile uint32 *Pin2 = HW_REGISTER_ADDRESS(0x42000000U + ((0x400253FCU - 0x40000000U) << 5) + (2U << 2));
+
+    Sim_Reset();
+    Test_EnablePortF();
+    GPIO_PORTF_DIR_REG = 0x0EU;
+    GPIO_PORTF_DEN_REG = 0x0EU;
+    TEST_PORTF_DATA(0x0EU) = 0x08U;
+
+    Sim_ResetCounters();
+    *Pin2 = 1U;
+    TEST_CHECK_EQUAL(0x0CU, Sim_GetPinLevels(5U));
+    TEST_CHECK_EQUAL(1U, *Pin2);
+    *Pin2 = 0U;
+    TEST_CHECK_EQUAL(0x08U, Sim_GetPinLevels(5U));
+
+    Sim_GetCounters(&Counters);
+    TEST_CHECK_EQUAL(3U, Counters.Bitband_Accesses);
+    TEST_CHECK_EQUAL(2U, Counters.Writes);
+    TEST_CHECK_EQUAL(1U, Counters.Reads);
+}
+
+/* The trace keeps the accesses in order with their values */
+static void Test_Trace(void)
+{
+    Sim_TraceType Access;
+
+    Sim_Reset();
+    SYSCTL_RCC2_REG |= 0x80000000U;
+    TEST_CHECK_EQUAL(2U, Sim_GetTraceCount());
+    TEST_CHECK(Sim_GetTrace(0U, &Access) == E_OK);
+    TEST_CHECK_EQUAL(0x400FE070U, Access.Address);
+    TEST_CHECK_EQUAL(FALSE, Access.Write);
+    TEST_CHECK_EQUAL(0x07C06810U, Access.Value);
+    TEST_CHECK(Sim_GetTrace(1U, &Access) == E_OK);
+    TEST_CHECK_EQUAL(TRUE, Access.Write);
+    TEST_CHECK_EQUAL(0x87C06810U, Access.Value);
+    TEST_CHECK(Sim_GetTrace(2U, &Access) == E_NOT_OK);
+}
+
+/* An empty count is about 0 (the call sites differ by a few instructions) and the instructions of a loop are counted */
+static void Test_InstructionCount(void)
+{
+    volatile uint32 Sum = 0;
+    uint32 Index;
+    uint32 Empty;
+    uint32 Loop;
+
+    Sim_StartInstructionCount();
+    Empty = Sim_StopInstructionCount();
+
+    Sim_StartInstructionCount();
+    for(Index = 0; Index < 100U; Index++)
+    {
+        Sum += Index;
+    }
+    Loop = Sim_StopInstructionCount();
+
+    TEST_CHECK(Empty <= 2U);
+    TEST_CHECK(Loop >= 300U);
+}
+
+int main(void)
+{
+    Sim_Init();
+
+    TEST_RUN(Test_UnlockCommit);
+    TEST_RUN(Test_MaskedAlias);
+    TEST_RUN(Test_PrgpioReadiness);
+    TEST_RUN(Test_Bitband);
+    TEST_RUN(Test_Trace);
+    TEST_RUN(Test_InstructionCount);
+
+    return TEST_RESULT();
+}
@@ -23,6 +23,9 @@
 //*****************************************************************************
 
 #include <stdint.h>
+#include "Std_Types.h"
+#include "Os_Cfg.h"
+#include "Port_Cfg.h"
 
 //*****************************************************************************
 //
@@ -34,6 +37,24 @@ static void NmiSR(void);
 static void FaultISR(void);
 static void IntDefaultHandler(void);
 extern void SysTick_Handler(void);
+#if (OS_PREEMPTIVE == STD_ON)
+extern void PendSV_Handler(void);
+#endif
+#if (PORT_PIN_EDGE_NOTIFICATION_API == STD_ON)
+extern void GPIOPortA_Handler(void);
+extern void GPIOPortB_Handler(void);
+extern void GPIOPortC_Handler(void);
+extern void GPIOPortD_Handler(void);
+extern void GPIOPortE_Handler(void);
+extern void GPIOPortF_Handler(void);
+#else
+#define GPIOPortA_Handler IntDefaultHandler
+#define GPIOPortB_Handler IntDefaultHandler
+#define GPIOPortC_Handler IntDefaultHandler
+#define GPIOPortD_Handler IntDefaultHandler
+#define GPIOPortE_Handler IntDefaultHandler
+#define GPIOPortF_Handler IntDefaultHandler
+#endif
 
 //*****************************************************************************
 //
@@ -82,13 +103,17 @@ void (* const g_pfnVectors[])(void) =
     IntDefaultHandler,                      // SVCall handler
     IntDefaultHandler,                      // Debug monitor handler
     0,                                      // Reserved
+#if (OS_PREEMPTIVE == STD_ON)
+    PendSV_Handler,                         // The PendSV handler
+#else
     IntDefaultHandler,                      // The PendSV handler
+#endif
     SysTick_Handler,                        // The SysTick handler
-    IntDefaultHandler,                      // GPIO Port A
-    IntDefaultHandler,                      // GPIO Port B
-    IntDefaultHandler,                      // GPIO Port C
-    IntDefaultHandler,                      // GPIO Port D
-    IntDefaultHandler,                      // GPIO Port E
+    GPIOPortA_Handler,                      // GPIO Port A
+    GPIOPortB_Handler,                      // GPIO Port B
+    GPIOPortC_Handler,                      // GPIO Port C
+    GPIOPortD_Handler,                      // GPIO Port D
+    GPIOPortE_Handler,                      // GPIO Port E
     IntDefaultHandler,                      // UART0 Rx and Tx
     IntDefaultHandler,                      // UART1 Rx and Tx
     IntDefaultHandler,                      // SSI0 Rx and Tx
@@ -114,7 +139,7 @@ void (* const g_pfnVectors[])(void) =
     IntDefaultHandler,                      // Analog Comparator 2
     IntDefaultHandler,                      // System Control (PLL, OSC, BO)
     IntDefaultHandler,                      // FLASH Control
-    IntDefaultHandler,                      // GPIO Port F
+    GPIOPortF_Handler,                      // GPIO Port F
     IntDefaultHandler,                      // GPIO Port G
     IntDefaultHandler,                      // GPIO Port H
     IntDefaultHandler,                      // UART2 Rx and Tx